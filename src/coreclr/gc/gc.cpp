@@ -22,8 +22,22 @@
 #define USE_VXSORT
 #else
 #define USE_INTROSORT
+#if defined(TARGET_ARM64)
+// no vxsort kernels on arm64, but we can still sort 32-bit packed offsets
+// instead of full pointers with NEON packing (see do_packed_sort)
+#define USE_PACKED_SORT
+#endif //TARGET_ARM64
 #endif
 
+#ifdef TARGET_ARM64
+// NEON intrinsics are used for mark list packing and card table scanning
+#ifdef _MSC_VER
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif //_MSC_VER
+#endif //TARGET_ARM64
+
 #ifdef DACCESS_COMPILE
 #error this source file should not be compiled with DACCESS_COMPILE!
 #endif //DACCESS_COMPILE
@@ -2297,6 +2311,10 @@ size_t      gc_heap::g_bpromoted;
 // for filling out ScanContext structs
 const int n_heaps = 1;
 
+#ifndef FEATURE_NATIVEAOT
+uint16_t    gc_heap::proc_no_to_numa_node[MAX_SUPPORTED_CPUS];
+#endif //!FEATURE_NATIVEAOT
+
 #endif //MULTIPLE_HEAPS
 
 size_t      gc_heap::card_table_element_layout[total_bookkeeping_elements + 1];
@@ -2324,6 +2342,12 @@ CLRCriticalSection gc_heap::check_commit_cs;
 
 CLRCriticalSection gc_heap::decommit_lock;
 
+#ifdef USE_REGIONS
+bool        gc_heap::decommit_thread_running_p = false;
+
+GCEvent     gc_heap::decommit_thread_wake_event;
+#endif //USE_REGIONS
+
 size_t      gc_heap::current_total_committed = 0;
 
 size_t      gc_heap::committed_by_oh[recorded_committed_bucket_counts];
@@ -2364,6 +2388,8 @@ double      gc_heap::short_plugs_pad_ratio = 0;
 
 int         gc_heap::generation_skip_ratio_threshold = 0;
 int         gc_heap::conserve_mem_setting = 0;
+
+VOLATILE(uint64_t) gc_heap::pause_budget_ms = 0;
 bool        gc_heap::spin_count_unit_config_p = false;
 
 uint64_t    gc_heap::suspended_start_time = 0;
@@ -2408,6 +2434,14 @@ size_t      gc_heap::heap_hard_limit = 0;
 
 size_t      gc_heap::heap_hard_limit_oh[total_oh_count];
 
+size_t      gc_heap::heap_soft_limit = 0;
+
+VOLATILE(int32_t) gc_heap::heap_soft_limit_state = 0;
+
+size_t      gc_heap::alloc_context_refill_max_shift = 0;
+
+BOOL        gc_heap::affinity_packing_p = FALSE;
+
 #ifdef USE_REGIONS
 
 size_t      gc_heap::regions_range = 0;
@@ -2447,6 +2481,8 @@ BOOL        gc_heap::dont_restart_ee_p = FALSE;
 
 BOOL        gc_heap::keep_bgc_threads_p = FALSE;
 
+BOOL        gc_heap::bgc_prespawn_threads_p = FALSE;
+
 GCEvent     gc_heap::bgc_threads_sync_event;
 
 BOOL        gc_heap::do_ephemeral_gc_p = FALSE;
@@ -2590,6 +2626,8 @@ int         gc_heap::sip_maxgen_regions_per_gen[max_generation + 1];
 
 heap_segment* gc_heap::reserved_free_regions_sip[max_generation];
 
+int         gc_heap::maxgen_compact_region_count = 0;
+
 int         gc_heap::new_gen0_regions_in_plns = 0;
 int         gc_heap::new_regions_in_prr = 0;
 int         gc_heap::new_regions_in_threading = 0;
@@ -2621,6 +2659,26 @@ size_t      gc_heap::mark_stack_array_length = 0;
 
 mark*       gc_heap::mark_stack_array = 0;
 
+#ifdef WKS_PARALLEL_MARK
+int         gc_heap::wks_mark_worker_count = 0;
+
+wks_mark_deque* gc_heap::wks_mark_deques = 0;
+
+wks_mark_worker_stats* gc_heap::wks_mark_stats = 0;
+
+GCEvent     gc_heap::wks_mark_start_event;
+
+GCEvent     gc_heap::wks_mark_done_event;
+
+VOLATILE(BOOL) gc_heap::wks_mark_active = FALSE;
+
+VOLATILE(BOOL) gc_heap::wks_mark_terminate = FALSE;
+
+VOLATILE(int32_t) gc_heap::wks_mark_idle_count = 0;
+
+VOLATILE(int32_t) gc_heap::wks_mark_workers_active = 0;
+#endif //WKS_PARALLEL_MARK
+
 #if defined (_DEBUG) && defined (VERIFY_HEAP)
 BOOL        gc_heap::verify_pinned_queue_p = FALSE;
 #endif //_DEBUG && VERIFY_HEAP
@@ -2810,6 +2868,8 @@ size_t        gc_heap::last_gc_end_time_us = 0;
 #endif //HEAP_BALANCE_INSTRUMENTATION
 #ifdef USE_REGIONS
 bool          gc_heap::enable_special_regions_p = false;
+
+int           gc_heap::incremental_compact_maxgen_regions = 0;
 #else //USE_REGIONS
 size_t        gc_heap::min_segment_size = 0;
 size_t        gc_heap::min_uoh_segment_size = 0;
@@ -2896,6 +2956,8 @@ uint8_t* gc_heap::alloc_allocated = 0;
 
 size_t gc_heap::allocation_quantum = CLR_SIZE;
 
+size_t gc_heap::soh_refill_quantum = CLR_SIZE;
+
 GCSpinLock gc_heap::more_space_lock_soh;
 GCSpinLock gc_heap::more_space_lock_uoh;
 
@@ -3223,9 +3285,14 @@ void gc_heap::fire_committed_usage_event()
     size_t new_current_total_committed;
     size_t new_current_total_committed_bookkeeping;
     size_t new_committed_by_oh[recorded_committed_bucket_counts];
+    // the decommit thread may be draining global_regions_to_decommit right now
+    if (decommit_thread_running_p)
+        decommit_lock.Enter();
     compute_committed_bytes(total_committed, committed_decommit, committed_free,
                             committed_bookkeeping, new_current_total_committed, new_current_total_committed_bookkeeping,
                             new_committed_by_oh);
+    if (decommit_thread_running_p)
+        decommit_lock.Leave();
 
     size_t total_committed_in_use = new_committed_by_oh[soh] + new_committed_by_oh[loh] + new_committed_by_oh[poh];
     size_t total_committed_in_global_decommit = committed_decommit;
@@ -3243,6 +3310,88 @@ void gc_heap::fire_committed_usage_event()
 #endif //FEATURE_EVENT_TRACE && USE_REGIONS
 }
 
+size_t gc_heap::get_mark_type_stats (GCHeapTypeStat* stats, size_t count)
+{
+    size_t num_entries = 0;
+
+#ifdef MULTIPLE_HEAPS
+    for (int hn = 0; hn < gc_heap::n_heaps; hn++)
+    {
+        gc_heap* hp = gc_heap::g_heaps [hn];
+#else //MULTIPLE_HEAPS
+    {
+        gc_heap* hp = 0;
+#endif //MULTIPLE_HEAPS
+        for (int i = 0; i < MARK_TYPE_STATS_TABLE_SIZE; i++)
+        {
+            mark_type_stats_entry* entry = &hp->mark_type_stats_table[i];
+            if (entry->method_table == 0)
+                continue;
+
+            // the tables are small so a linear merge is plenty fast for a diag API.
+            size_t merge_idx;
+            for (merge_idx = 0; merge_idx < num_entries; merge_idx++)
+            {
+                if (stats[merge_idx].methodTable == entry->method_table)
+                {
+                    stats[merge_idx].sampledByteCount += entry->sampled_bytes;
+                    stats[merge_idx].sampledObjectCount += entry->sampled_objects;
+                    break;
+                }
+            }
+
+            if ((merge_idx == num_entries) && (num_entries < count))
+            {
+                stats[num_entries].methodTable = entry->method_table;
+                stats[num_entries].sampledByteCount = entry->sampled_bytes;
+                stats[num_entries].sampledObjectCount = entry->sampled_objects;
+                num_entries++;
+            }
+        }
+    }
+
+    return num_entries;
+}
+
+// This fires one HeapTypeStats event per type for the largest types sampled during the
+// most recent mark phase. It's fired at the end of each GC, when marking is complete -
+// for BGCs the stats describe the whole heap, for ephemeral GCs only the condemned
+// generations.
+void gc_heap::fire_heap_type_stats_event()
+{
+#ifdef FEATURE_EVENT_TRACE
+    if (!EVENT_ENABLED (GCMarkWithType)) return;
+
+    GCHeapTypeStat stats[MARK_TYPE_STATS_TABLE_SIZE];
+    size_t num_entries = get_mark_type_stats (stats, MARK_TYPE_STATS_TABLE_SIZE);
+
+    // Only fire the biggest contributors - that's what heap composition
+    // investigations care about.
+    const size_t max_types_to_fire = 10;
+    size_t num_to_fire = min (num_entries, max_types_to_fire);
+    for (size_t i = 0; i < num_to_fire; i++)
+    {
+        size_t biggest = i;
+        for (size_t j = i + 1; j < num_entries; j++)
+        {
+            if (stats[j].sampledByteCount > stats[biggest].sampledByteCount)
+            {
+                biggest = j;
+            }
+        }
+        GCHeapTypeStat temp = stats[i];
+        stats[i] = stats[biggest];
+        stats[biggest] = temp;
+
+        GCEventFireHeapTypeStats_V1 (
+            (uint64_t)(size_t)stats[i].methodTable,
+            stats[i].sampledByteCount,
+            stats[i].sampledObjectCount,
+            (uint64_t)MARK_TYPE_STATS_SAMPLE_INTERVAL);
+    }
+#endif //FEATURE_EVENT_TRACE
+}
+
 inline BOOL
 gc_heap::dt_low_ephemeral_space_p (gc_tuning_point tp)
 {
@@ -7243,6 +7392,32 @@ void gc_heap::gc_thread_function ()
 
 #endif //MULTIPLE_HEAPS
 
+#if !defined(MULTIPLE_HEAPS) && !defined(FEATURE_NATIVEAOT)
+void gc_heap::init_numa_node_map()
+{
+    for (int i = 0; i < MAX_SUPPORTED_CPUS; i++)
+    {
+        proc_no_to_numa_node[i] = NUMA_NODE_UNDEFINED;
+    }
+
+    if (!GCToOSInterface::CanEnableGCNumaAware() || !GCToOSInterface::CanGetCurrentProcessorNumber())
+    {
+        return;
+    }
+
+    // GetProcessorForHeap hands back the proc and node of the i-th active processor.
+    for (uint16_t i = 0; i < (uint16_t)g_num_active_processors; i++)
+    {
+        uint16_t proc_no;
+        uint16_t node_no;
+        if (!GCToOSInterface::GetProcessorForHeap (i, &proc_no, &node_no))
+            break;
+        assert (proc_no < MAX_SUPPORTED_CPUS);
+        proc_no_to_numa_node[proc_no] = node_no;
+    }
+}
+#endif //!MULTIPLE_HEAPS && !FEATURE_NATIVEAOT
+
 bool gc_heap::virtual_alloc_commit_for_heap (void* addr, size_t size, int h_number)
 {
 #if defined(MULTIPLE_HEAPS) && !defined(FEATURE_NATIVEAOT)
@@ -7259,6 +7434,21 @@ bool gc_heap::virtual_alloc_commit_for_heap (void* addr, size_t size, int h_numb
                 return true;
         }
     }
+#elif !defined(FEATURE_NATIVEAOT) //MULTIPLE_HEAPS && !FEATURE_NATIVEAOT
+    UNREFERENCED_PARAMETER(h_number);
+    if (GCToOSInterface::CanEnableGCNumaAware() && GCToOSInterface::CanGetCurrentProcessorNumber())
+    {
+        // workstation GC has no heap to node affinity - commit on the node of the
+        // requesting thread instead, so memory handed out to refill an alloc_context
+        // ends up local to the thread that is going to allocate from it.
+        uint32_t proc_no = GCToOSInterface::GetCurrentProcessorNumber();
+        uint16_t numa_node = (proc_no < MAX_SUPPORTED_CPUS) ? proc_no_to_numa_node[proc_no] : NUMA_NODE_UNDEFINED;
+        if (numa_node != NUMA_NODE_UNDEFINED)
+        {
+            if (GCToOSInterface::VirtualCommit (addr, size, numa_node))
+                return true;
+        }
+    }
 #else //MULTIPLE_HEAPS && !FEATURE_NATIVEAOT
     UNREFERENCED_PARAMETER(h_number);
 #endif //MULTIPLE_HEAPS && !FEATURE_NATIVEAOT
@@ -7350,6 +7540,11 @@ bool gc_heap::virtual_commit (void* address, size_t size, int bucket, int h_numb
                               virtual_alloc_commit_for_heap (address, size, h_number)) :
                               GCToOSInterface::VirtualCommit(address, size));
 
+    if (commit_succeeded_p)
+    {
+        check_heap_soft_limit();
+    }
+
     if (!commit_succeeded_p && heap_hard_limit)
     {
         check_commit_cs.Enter();
@@ -7418,11 +7613,32 @@ bool gc_heap::virtual_decommit (void* address, size_t size, int bucket, int h_nu
             current_total_committed_bookkeeping -= size;
         }
         check_commit_cs.Leave();
+
+        check_heap_soft_limit();
     }
 
     return decommit_succeeded_p;
 }
 
+void gc_heap::check_heap_soft_limit()
+{
+    if (heap_soft_limit == 0)
+        return;
+
+    // this read is deliberately unsynchronized - the soft limit is a heuristic watermark
+    // and a slightly stale value just shifts the crossing by one commit.
+    size_t total_committed = current_total_committed;
+    int32_t state = (total_committed >= heap_soft_limit) ? 1 : 0;
+    int32_t old_state = Interlocked::CompareExchange (&heap_soft_limit_state, state, (int32_t)(1 - state));
+    if ((old_state == 0) && (state == 1))
+    {
+        dprintf (1, ("committed %zd crossed the soft limit %zd", total_committed, heap_soft_limit));
+#ifdef FEATURE_EVENT_TRACE
+        GCEventFireHeapSoftLimitExceeded_V1 ((uint64_t)total_committed, (uint64_t)heap_soft_limit);
+#endif //FEATURE_EVENT_TRACE
+    }
+}
+
 void gc_heap::virtual_free (void* add, size_t allocated_size, heap_segment* sg)
 {
     bool release_succeeded_p = GCToOSInterface::VirtualRelease (add, allocated_size);
@@ -10188,7 +10404,8 @@ void rqsort1( uint8_t* *low, uint8_t* *high)
 
 // vxsort uses introsort as a fallback if the AVX2 instruction set is not supported
 #if defined(USE_INTROSORT) || defined(USE_VXSORT)
-class introsort
+template <class T>
+class introsort_t
 {
 
 private:
@@ -10196,15 +10413,15 @@ private:
     static const int max_depth = 100;
 
 
-inline static void swap_elements(uint8_t** i,uint8_t** j)
+inline static void swap_elements(T* i,T* j)
     {
-        uint8_t* t=*i;
+        T t=*i;
         *i=*j;
         *j=t;
     }
 
 public:
-    static void sort (uint8_t** begin, uint8_t** end, int ignored)
+    static void sort (T* begin, T* end, int ignored)
     {
         ignored = 0;
         introsort_loop (begin, end, max_depth);
@@ -10213,7 +10430,7 @@ public:
 
 private:
 
-    static void introsort_loop (uint8_t** lo, uint8_t** hi, int depth_limit)
+    static void introsort_loop (T* lo, T* hi, int depth_limit)
     {
         while (hi-lo >= size_threshold)
         {
@@ -10222,16 +10439,16 @@ private:
                 heapsort (lo, hi);
                 return;
             }
-            uint8_t** p=median_partition (lo, hi);
+            T* p=median_partition (lo, hi);
             depth_limit=depth_limit-1;
             introsort_loop (p, hi, depth_limit);
             hi=p-1;
         }
     }
 
-    static uint8_t** median_partition (uint8_t** low, uint8_t** high)
+    static T* median_partition (T* low, T* high)
     {
-        uint8_t *pivot, **left, **right;
+        T pivot, *left, *right;
 
         //sort low middle and high
         if (*(low+((high-low)/2)) < *low)
@@ -10259,12 +10476,12 @@ private:
     }
 
 
-    static void insertionsort (uint8_t** lo, uint8_t** hi)
+    static void insertionsort (T* lo, T* hi)
     {
-        for (uint8_t** i=lo+1; i <= hi; i++)
+        for (T* i=lo+1; i <= hi; i++)
         {
-            uint8_t** j = i;
-            uint8_t* t = *i;
+            T* j = i;
+            T t = *i;
             while((j > lo) && (t <*(j-1)))
             {
                 *j = *(j-1);
@@ -10274,7 +10491,7 @@ private:
         }
     }
 
-    static void heapsort (uint8_t** lo, uint8_t** hi)
+    static void heapsort (T* lo, T* hi)
     {
         size_t n = hi - lo + 1;
         for (size_t i=n / 2; i >= 1; i--)
@@ -10288,9 +10505,9 @@ private:
         }
     }
 
-    static void downheap (size_t i, size_t n, uint8_t** lo)
+    static void downheap (size_t i, size_t n, T* lo)
     {
-        uint8_t* d = *(lo + i - 1);
+        T d = *(lo + i - 1);
         size_t child;
         while (i <= n / 2)
         {
@@ -10311,8 +10528,85 @@ private:
 
 };
 
+
+// the existing callers sort the mark list, ie, arrays of object pointers
+typedef introsort_t<uint8_t*> introsort;
+
 #endif //defined(USE_INTROSORT) || defined(USE_VXSORT)
 
+#ifdef USE_PACKED_SORT
+// There are no vxsort kernels on arm64, but a good chunk of the benefit comes
+// from sorting 32-bit packed offsets instead of full pointers: packing halves
+// the data the sort itself touches and the pack/unpack passes vectorize with
+// NEON. Offsets are shifted by 3 since objects are 8 byte aligned, so ranges
+// up to 32 GB can be packed.
+static void do_packed_sort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* range_low, uint8_t* range_high)
+{
+    // below this size the pack/unpack passes aren't worth it
+    const ptrdiff_t PACKED_SORT_THRESHOLD_SIZE = 1024;
+
+    if (item_count <= 1)
+        return;
+
+    uint8_t* base = (uint8_t*)((size_t)range_low & ~(size_t)7);
+    size_t range = (size_t)(range_high - base);
+
+    if ((item_count < PACKED_SORT_THRESHOLD_SIZE) || (range >= ((size_t)UINT32_MAX << 3)))
+    {
+        introsort::sort (item_array, &item_array[item_count - 1], 0);
+        return;
+    }
+
+    // pack the pointers in place into the low half of the array - within each
+    // iteration the 16 packed bytes are written below the 32 bytes read.
+    uint32_t* packed = (uint32_t*)item_array;
+    uint64x2_t v_base = vdupq_n_u64 ((uint64_t)(size_t)base);
+    ptrdiff_t i = 0;
+    for (; (i + 4) <= item_count; i += 4)
+    {
+        uint64x2_t p01 = vld1q_u64 ((const uint64_t*)&item_array[i]);
+        uint64x2_t p23 = vld1q_u64 ((const uint64_t*)&item_array[i + 2]);
+        uint32x2_t o01 = vmovn_u64 (vshrq_n_u64 (vsubq_u64 (p01, v_base), 3));
+        uint32x2_t o23 = vmovn_u64 (vshrq_n_u64 (vsubq_u64 (p23, v_base), 3));
+        vst1q_u32 (&packed[i], vcombine_u32 (o01, o23));
+    }
+    for (; i < item_count; i++)
+    {
+        assert (((size_t)item_array[i] & 7) == 0);
+        packed[i] = (uint32_t)((size_t)(item_array[i] - base) >> 3);
+    }
+
+    introsort_t<uint32_t>::sort (packed, &packed[item_count - 1], 0);
+
+    // unpack back into pointers, highest index first since the data expands
+    i = item_count;
+    while ((i & 3) != 0)
+    {
+        i--;
+        item_array[i] = base + ((size_t)packed[i] << 3);
+    }
+    while (i >= 4)
+    {
+        i -= 4;
+        uint32x4_t o = vld1q_u32 (&packed[i]);
+        uint64x2_t p01 = vaddq_u64 (vshlq_n_u64 (vmovl_u32 (vget_low_u32 (o)), 3), v_base);
+        uint64x2_t p23 = vaddq_u64 (vshlq_n_u64 (vmovl_u32 (vget_high_u32 (o)), 3), v_base);
+        vst1q_u64 ((uint64_t*)&item_array[i], p01);
+        vst1q_u64 ((uint64_t*)&item_array[i + 2], p23);
+    }
+
+#ifdef _DEBUG
+    // check the array is sorted
+    for (ptrdiff_t j = 0; j < item_count - 1; j++)
+    {
+        assert (item_array[j] <= item_array[j + 1]);
+    }
+    // check that the ends of the array are indeed in range
+    assert ((range_low <= item_array[0]) && (item_array[item_count - 1] <= range_high));
+#endif //_DEBUG
+}
+#endif //USE_PACKED_SORT
+
 #ifdef USE_VXSORT
 static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* range_low, uint8_t* range_high)
 {
@@ -10582,7 +10876,11 @@ size_t gc_heap::sort_mark_list()
     dprintf (3, ("Sorting mark lists"));
     if (local_mark_list_index > mark_list)
     {
+#ifdef USE_PACKED_SORT
+        do_packed_sort (mark_list, local_mark_list_index - mark_list, low, high);
+#else //USE_PACKED_SORT
         introsort::sort (mark_list, local_mark_list_index - 1, 0);
+#endif //USE_PACKED_SORT
     }
 #endif //USE_VXSORT
 
@@ -13514,33 +13812,57 @@ void gc_heap::distribute_free_regions()
     {
         if (global_regions_to_decommit[kind].get_num_free_regions() != 0)
         {
-            gradual_decommit_in_progress_p = TRUE;
+            if (decommit_thread_running_p)
+            {
+                wake_decommit_thread();
+            }
+            else
+            {
+                gradual_decommit_in_progress_p = TRUE;
+            }
             break;
         }
     }
 #else //MULTIPLE_HEAPS
-    // we want to limit the amount of decommit we do per time to indirectly
-    // limit the amount of time spent in recommit and page faults
-    // we use the elapsed time since the last GC to arrive at the desired
-    // decommit size
-    // we limit the elapsed time to 10 seconds to avoid spending too much time decommitting
-    // if less than DECOMMIT_TIME_STEP_MILLISECONDS elapsed, we don't decommit -
-    // we don't want to decommit fractions of regions here
-    dynamic_data* dd0 = dynamic_data_of (0);
-    size_t ephemeral_elapsed = (size_t)((dd_time_clock (dd0) - gc_last_ephemeral_decommit_time) / 1000);
-    if (ephemeral_elapsed >= DECOMMIT_TIME_STEP_MILLISECONDS)
+    if (decommit_thread_running_p)
     {
-        gc_last_ephemeral_decommit_time = dd_time_clock (dd0);
-        size_t decommit_step_milliseconds = min (ephemeral_elapsed, (10*1000));
-
-        decommit_step (decommit_step_milliseconds);
+        // leave the regions on the decommit list - the decommit thread will return
+        // them to the OS outside the pause; anything still queued at the next GC
+        // gets picked up as surplus again at the top of this function.
+        for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
+        {
+            if (global_regions_to_decommit[kind].get_num_free_regions() != 0)
+            {
+                wake_decommit_thread();
+                break;
+            }
+        }
     }
-    // transfer any remaining regions on the decommit list back to the free list
-    for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
+    else
     {
-        if (global_regions_to_decommit[kind].get_num_free_regions() != 0)
+        // we want to limit the amount of decommit we do per time to indirectly
+        // limit the amount of time spent in recommit and page faults
+        // we use the elapsed time since the last GC to arrive at the desired
+        // decommit size
+        // we limit the elapsed time to 10 seconds to avoid spending too much time decommitting
+        // if less than DECOMMIT_TIME_STEP_MILLISECONDS elapsed, we don't decommit -
+        // we don't want to decommit fractions of regions here
+        dynamic_data* dd0 = dynamic_data_of (0);
+        size_t ephemeral_elapsed = (size_t)((dd_time_clock (dd0) - gc_last_ephemeral_decommit_time) / 1000);
+        if (ephemeral_elapsed >= DECOMMIT_TIME_STEP_MILLISECONDS)
+        {
+            gc_last_ephemeral_decommit_time = dd_time_clock (dd0);
+            size_t decommit_step_milliseconds = min (ephemeral_elapsed, (10*1000));
+
+            decommit_step (decommit_step_milliseconds);
+        }
+        // transfer any remaining regions on the decommit list back to the free list
+        for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
         {
-            free_regions[kind].transfer_regions (&global_regions_to_decommit[kind]);
+            if (global_regions_to_decommit[kind].get_num_free_regions() != 0)
+            {
+                free_regions[kind].transfer_regions (&global_regions_to_decommit[kind]);
+            }
         }
     }
 #endif //MULTIPLE_HEAPS
@@ -14056,6 +14378,8 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
 
     conserve_mem_setting = (int)GCConfig::GetGCConserveMem();
 
+    pause_budget_ms = (uint64_t)GCConfig::GetGCPauseBudget();
+
 #ifdef DYNAMIC_HEAP_COUNT
     dynamic_adaptation_mode = (int)GCConfig::GetGCDynamicAdaptationMode();
     if (GCConfig::GetHeapCount() != 0)
@@ -14116,6 +14440,12 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
 #else //MULTIPLE_HEAPS
     reserved_memory_limit = initial_heap_size;
     int number_of_heaps = 1;
+#ifndef FEATURE_NATIVEAOT
+    init_numa_node_map();
+#endif //!FEATURE_NATIVEAOT
+#ifdef WKS_PARALLEL_MARK
+    wks_parallel_mark_init();
+#endif //WKS_PARALLEL_MARK
 #endif //MULTIPLE_HEAPS
 
 #ifndef COMMITTED_BYTES_SHADOW
@@ -14147,6 +14477,9 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
 
         if (!allocate_initial_regions(number_of_heaps))
             return E_OUTOFMEMORY;
+
+        // if this fails we simply keep decommitting free regions on the GC threads.
+        init_decommit_thread();
     }
     else
     {
@@ -14472,10 +14805,23 @@ gc_heap::init_semi_shared()
     }
 #endif //BGC_SERVO_TUNING
 
+    {
+        // Convert the configured max scale to a shift count, rounding down to a power of 2.
+        size_t refill_max_scale = (size_t)min (max ((int64_t)1, GCConfig::GetAllocContextRefillMaxScale()), (int64_t)1024);
+        alloc_context_refill_max_shift = 0;
+        while (((size_t)2 << alloc_context_refill_max_shift) <= refill_max_scale)
+        {
+            alloc_context_refill_max_shift++;
+        }
+    }
+
+    affinity_packing_p = GCConfig::GetAffinityPacking();
+
 #ifdef BACKGROUND_GC
     memset (ephemeral_fgc_counts, 0, sizeof (ephemeral_fgc_counts));
     bgc_alloc_spin_count = static_cast<uint32_t>(GCConfig::GetBGCSpinCount());
     bgc_alloc_spin = static_cast<uint32_t>(GCConfig::GetBGCSpin());
+    bgc_prespawn_threads_p = GCConfig::GetBGCPrespawnThreads();
 
     {
         int number_bgc_threads = get_num_heaps();
@@ -14817,6 +15163,8 @@ gc_heap::init_gc_heap (int h_number)
 
     allocation_quantum = CLR_SIZE;
 
+    soh_refill_quantum = CLR_SIZE;
+
     more_space_lock_soh = gc_lock;
 
     more_space_lock_uoh = gc_lock;
@@ -15734,6 +16082,7 @@ allocator::allocator (unsigned int num_b, int fbb, alloc_list* b, int gen)
     first_bucket_bits = fbb;
     buckets = b;
     gen_number = gen;
+    recompute_bucket_bitmap();
 }
 
 alloc_list& allocator::alloc_list_of (unsigned int bn)
@@ -15754,6 +16103,40 @@ size_t& allocator::alloc_list_damage_count_of (unsigned int bn)
         return buckets [bn-1].alloc_list_damage_count();
 }
 
+void allocator::clear_bucket_bit_if_empty (unsigned int bn)
+{
+    alloc_list* al = &alloc_list_of (bn);
+
+    if (al->alloc_list_head() != 0)
+        return;
+
+#ifdef DOUBLY_LINKED_FL
+    if (al->added_alloc_list_head() != 0)
+        return;
+#endif //DOUBLY_LINKED_FL
+
+    bucket_bitmap &= ~((uint32_t)1 << bn);
+}
+
+void allocator::recompute_bucket_bitmap()
+{
+    bucket_bitmap = 0;
+
+    for (unsigned int i = 0; i < num_buckets; i++)
+    {
+        alloc_list* al = &alloc_list_of (i);
+        BOOL non_empty_p = (al->alloc_list_head() != 0);
+#ifdef DOUBLY_LINKED_FL
+        non_empty_p |= (al->added_alloc_list_head() != 0);
+#endif //DOUBLY_LINKED_FL
+
+        if (non_empty_p)
+        {
+            set_bucket_bit (i);
+        }
+    }
+}
+
 void allocator::unlink_item (unsigned int bn, uint8_t* item, uint8_t* prev_item, BOOL use_undo_p)
 {
     alloc_list* al = &alloc_list_of (bn);
@@ -15813,6 +16196,8 @@ void allocator::unlink_item (unsigned int bn, uint8_t* item, uint8_t* prev_item,
     {
         assert (al->alloc_list_tail() == 0);
     }
+
+    clear_bucket_bit_if_empty (bn);
 }
 
 #ifdef DOUBLY_LINKED_FL
@@ -15879,6 +16264,8 @@ void allocator::unlink_item_no_undo (unsigned int bn, uint8_t* item)
             (al->alloc_list_tail() ? free_list_slot (al->alloc_list_tail()) : 0),
             (al->alloc_list_tail() ? free_list_prev (al->alloc_list_tail()) : 0)));
     }
+
+    clear_bucket_bit_if_empty (bn);
 }
 
 void allocator::unlink_item_no_undo (uint8_t* item, size_t size)
@@ -15929,6 +16316,8 @@ void allocator::unlink_item_no_undo_added (unsigned int bn, uint8_t* item, uint8
             (al->added_alloc_list_tail() ? free_list_slot (al->added_alloc_list_tail()) : 0),
             (al->added_alloc_list_tail() ? free_list_prev (al->added_alloc_list_tail()) : 0)));
     }
+
+    clear_bucket_bit_if_empty (bn);
 }
 
 int allocator::thread_item_front_added (uint8_t* item, size_t size)
@@ -15953,6 +16342,8 @@ int allocator::thread_item_front_added (uint8_t* item, size_t size)
         al->added_alloc_list_tail() = item;
     }
 
+    set_bucket_bit (a_l_number);
+
     if (gen_number == max_generation)
     {
         dprintf (3333, ("[g%2d, b%2d]TFFA: exit: %p->%p->%p (h: %p, t: %p)",
@@ -16177,6 +16568,8 @@ void allocator::merge_items (gc_heap* current_heap, int to_num_heaps, int from_n
             }
         }
     }
+
+    recompute_bucket_bitmap();
 }
 #endif //DYNAMIC_HEAP_COUNT
 
@@ -16187,6 +16580,8 @@ void allocator::clear()
         alloc_list_head_of (i) = 0;
         alloc_list_tail_of (i) = 0;
     }
+
+    bucket_bitmap = 0;
 }
 
 //always thread to the end.
@@ -16228,6 +16623,8 @@ void allocator::thread_item (uint8_t* item, size_t size)
 
     tail = item;
 
+    set_bucket_bit (a_l_number);
+
 #ifdef DOUBLY_LINKED_FL
     if (gen_number == max_generation)
     {
@@ -16280,6 +16677,8 @@ void allocator::thread_item_front (uint8_t* item, size_t size)
         al->alloc_list_tail() = item;
     }
 
+    set_bucket_bit (a_l_number);
+
 #ifdef DOUBLY_LINKED_FL
     if (gen_number == max_generation)
     {
@@ -16407,6 +16806,8 @@ void allocator::copy_from_alloc_list (alloc_list* fromalist)
         assert ((tail_item == 0) || (free_list_slot (tail_item) == 0));
 #endif
     }
+
+    recompute_bucket_bitmap();
 }
 
 void allocator::commit_alloc_list_changes()
@@ -16503,6 +16904,8 @@ void allocator::commit_alloc_list_changes()
             }
 #endif //DOUBLY_LINKED_FL
         }
+
+        recompute_bucket_bitmap();
     }
 }
 
@@ -16538,6 +16941,8 @@ void allocator::thread_sip_fl (heap_segment* region)
         }
 
         tail = region_fl_tail;
+
+        set_bucket_bit (0);
     }
     else
     {
@@ -16872,8 +17277,9 @@ size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_li
     assert ((gen_number != 0) || (physical_limit >= padded_size));
 
     // For SOH if the size asked for is very small, we want to allocate more than just what's asked for if possible.
-    // Unless we were told not to clean, then we will not force it.
-    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? allocation_quantum : 0);
+    // Unless we were told not to clean, then we will not force it. The quantum used here is the per context
+    // scaled one computed at the start of this refill.
+    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? soh_refill_quantum : 0);
 
     size_t desired_size_to_allocate  = max (padded_size, min_size_to_allocate);
     size_t new_physical_limit = min (physical_limit, desired_size_to_allocate);
@@ -16881,6 +17287,24 @@ size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_li
     size_t new_limit = new_allocation_limit (padded_size,
                                              new_physical_limit,
                                              gen_number);
+
+    if ((heap_soft_limit != 0) && (gen_number == 0) && (new_limit > padded_size))
+    {
+        // unsynchronized read - see check_heap_soft_limit.
+        size_t total_committed = current_total_committed;
+        if (total_committed >= heap_soft_limit)
+        {
+            // Proportionally shrink the allocation context as committed bytes climb from
+            // the soft limit toward the hard limit, so allocating threads come back to
+            // the allocator more often and GCs get a chance to shed memory before the
+            // hard limit turns into OOM.
+            size_t headroom = heap_hard_limit - heap_soft_limit;
+            size_t used = min ((total_committed - heap_soft_limit), headroom);
+            size_t extra = new_limit - padded_size;
+            new_limit = padded_size + (size_t)(((uint64_t)extra * (headroom - used)) / headroom);
+        }
+    }
+
     assert (new_limit >= (size + Align (min_obj_size, align_const)));
     dprintf (3, ("h%d requested to allocate %zd bytes, actual size is %zd, phy limit: %zd",
         heap_number, size, new_limit, physical_limit));
@@ -18814,6 +19238,19 @@ bool gc_heap::update_alloc_info (int gen_number, size_t allocated_size, size_t*
     return exceeded_p;
 }
 
+inline
+size_t gc_heap::get_alloc_context_quantum (alloc_context* acontext)
+{
+    // Scale the quantum up for contexts that have refilled many times - those belong to
+    // allocation heavy threads, where a bigger refill means fewer trips through the
+    // shared allocator, while threads that allocate rarely keep the small quantum so
+    // they don't waste gen0 space. The quantum doubles every 64 refills up to the
+    // configured bound; scaling back down happens through the regular end of GC
+    // recomputation of allocation_quantum that this multiplies.
+    size_t shift = min ((size_t)(acontext->get_alloc_count() >> 6), alloc_context_refill_max_shift);
+    return (allocation_quantum << shift);
+}
+
 allocation_state gc_heap::try_allocate_more_space (alloc_context* acontext, size_t size,
                                     uint32_t flags, int gen_number)
 {
@@ -18857,6 +19294,15 @@ allocation_state gc_heap::try_allocate_more_space (alloc_context* acontext, size
 
     int align_const = get_alignment_constant (gen_number <= max_generation);
 
+    if (gen_number == 0)
+    {
+#ifndef MULTIPLE_HEAPS
+        // balance_heaps maintains the refill count for server GC.
+        acontext->inc_alloc_count();
+#endif //!MULTIPLE_HEAPS
+        soh_refill_quantum = get_alloc_context_quantum (acontext);
+    }
+
     if (fgn_maxgen_percent)
     {
         check_for_full_gc (gen_number, size);
@@ -19714,8 +20160,53 @@ uint8_t* gc_heap::allocate_in_older_generation (generation* gen, size_t size,
     if (! (size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, generation_allocation_pointer (gen),
                        generation_allocation_limit (gen), old_loc, USE_PADDING_TAIL | pad_in_front)))
     {
-        for (unsigned int a_l_idx = gen_allocator->first_suitable_bucket(real_size * 2);
-             a_l_idx < gen_allocator->number_of_buckets(); a_l_idx++)
+        // Exact fit fast path: the scan below starts at the first bucket
+        // guaranteed to fit real_size, which is one size class up from the
+        // bucket real_size itself maps to. Pool style workloads free and
+        // reallocate the same few size classes, so the head of the size
+        // matched bucket usually fits - and a tighter fit wastes less of the
+        // free item than taking one from a larger bucket. Bucket 0 keeps its
+        // first-fit-and-discard treatment in the regular loop.
+        {
+            unsigned int a_l_idx = gen_allocator->first_suitable_bucket (real_size);
+            if (a_l_idx != 0)
+            {
+                uint8_t* free_list = gen_allocator->alloc_list_head_of (a_l_idx);
+                if (free_list != 0)
+                {
+                    size_t free_list_size = unused_array_size (free_list);
+                    if (size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, free_list, (free_list + free_list_size),
+                                    old_loc, USE_PADDING_TAIL | pad_in_front))
+                    {
+                        dprintf (4, ("EF:%zx-%zd", (size_t)free_list, free_list_size));
+
+                        gen_allocator->unlink_item (a_l_idx, free_list, 0, !discard_p);
+                        generation_free_list_space (gen) -= free_list_size;
+                        assert ((ptrdiff_t)generation_free_list_space (gen) >= 0);
+                        remove_gen_free (gen->gen_num, free_list_size);
+
+#ifdef DOUBLY_LINKED_FL
+                        if (record_free_list_allocated_p)
+                        {
+                            generation_set_bgc_mark_bit_p (gen) = should_set_bgc_mark_bit (free_list);
+                            dprintf (3333, ("SFE: %p(%d)", free_list, (generation_set_bgc_mark_bit_p (gen) ? 1 : 0)));
+                        }
+#endif //DOUBLY_LINKED_FL
+
+                        adjust_limit (free_list, free_list_size, gen);
+                        generation_allocate_end_seg_p (gen) = FALSE;
+                        goto finished;
+                    }
+                }
+            }
+        }
+
+        // Jump straight to buckets that may actually have free items - when the free
+        // list is fragmented into many size classes most buckets are empty and there
+        // is no point walking them one by one.
+        for (unsigned int a_l_idx = gen_allocator->first_suitable_non_empty_bucket(real_size * 2);
+             a_l_idx < gen_allocator->number_of_buckets();
+             a_l_idx = gen_allocator->next_non_empty_bucket(a_l_idx + 1))
         {
             uint8_t* free_list = 0;
             uint8_t* prev_free_item = 0;
@@ -19784,6 +20275,44 @@ uint8_t* gc_heap::allocate_in_older_generation (generation* gen, size_t size,
             free_list = gen_allocator->alloc_list_head_of (a_l_idx);
             prev_free_item = 0;
 
+            if (affinity_packing_p && (a_l_idx != 0) && !discard_p)
+            {
+                // Consider the first few fitting items and start the regular loop below
+                // at the one nearest the previous plug's destination, instead of taking
+                // the bucket head. Consecutive surviving plugs tend to reference each
+                // other - they were allocated together - so placing them in nearby holes
+                // keeps pointer chasing working sets dense after compaction.
+                const int max_items_to_consider = 16;
+                uint8_t* target = generation_allocation_pointer (gen);
+                uint8_t* best_item = 0;
+                uint8_t* best_prev_item = 0;
+                size_t best_distance = 0;
+                uint8_t* item = free_list;
+                uint8_t* prev_item = 0;
+                for (int i = 0; (item != 0) && (i < max_items_to_consider); i++)
+                {
+                    size_t item_size = unused_array_size (item);
+                    if (size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, item, (item + item_size),
+                                    old_loc, USE_PADDING_TAIL | pad_in_front))
+                    {
+                        size_t distance = (item > target) ? (item - target) : (target - item);
+                        if ((best_item == 0) || (distance < best_distance))
+                        {
+                            best_item = item;
+                            best_prev_item = prev_item;
+                            best_distance = distance;
+                        }
+                    }
+                    prev_item = item;
+                    item = free_list_slot (item);
+                }
+                if (best_item != 0)
+                {
+                    free_list = best_item;
+                    prev_free_item = best_prev_item;
+                }
+            }
+
             while (free_list != 0)
             {
                 dprintf (3, ("considering free list %zx", (size_t)free_list));
@@ -20871,6 +21400,32 @@ int gc_heap::joined_generation_to_condemn (BOOL should_evaluate_elevation,
     }
 #endif //BGC_SERVO_TUNING
 
+    // If the host declared a pause budget, try to honor it: when the last recorded pause
+    // of the kind we are about to incur exceeded the budget, demote the collection -
+    // unless something above already decided this GC cannot be reduced. Collections
+    // deferred this way simply happen later, once the budget is relaxed.
+    uint64_t pause_budget_us = (uint64_t)pause_budget_ms * 1000;
+    if ((pause_budget_us != 0) && (initial_gen < n) &&
+        !joined_last_gc_before_oom && !provisional_mode_triggered && !settings.loh_compaction)
+    {
+        if ((n == max_generation) && *blocking_collection_p &&
+            (last_full_blocking_gc_info.pause_durations[0] > pause_budget_us))
+        {
+            dprintf (GTC_LOG, ("pause budget %zdus: last full blocking pause was %zdus, 2->1",
+                (size_t)pause_budget_us, last_full_blocking_gc_info.pause_durations[0]));
+            n = max_generation - 1;
+        }
+
+        if ((n == (max_generation - 1)) && (initial_gen == 0) &&
+            (last_ephemeral_gc_info.condemned_generation == (max_generation - 1)) &&
+            (last_ephemeral_gc_info.pause_durations[0] > pause_budget_us))
+        {
+            dprintf (GTC_LOG, ("pause budget %zdus: last gen1 pause was %zdus, 1->0",
+                (size_t)pause_budget_us, last_ephemeral_gc_info.pause_durations[0]));
+            n = 0;
+        }
+    }
+
     if ((n == max_generation) && (*blocking_collection_p == FALSE))
     {
         // If we are doing a gen2 we should reset elevation regardless and let the gen2
@@ -22630,7 +23185,12 @@ void gc_heap::gc1()
             }
 #ifdef USE_REGIONS
             initGCShadow();
+            // the decommit thread may be draining global_regions_to_decommit right now
+            if (decommit_thread_running_p)
+                decommit_lock.Enter();
             distribute_free_regions();
+            if (decommit_thread_running_p)
+                decommit_lock.Leave();
             verify_region_to_generation_map ();
             compute_gc_and_ephemeral_range (settings.condemned_generation, true);
             stomp_write_barrier_ephemeral (ephemeral_low, ephemeral_high,
@@ -22700,7 +23260,12 @@ void gc_heap::gc1()
         rearrange_uoh_segments();
 #ifdef USE_REGIONS
         initGCShadow();
+        // the decommit thread may be draining global_regions_to_decommit right now
+        if (decommit_thread_running_p)
+            decommit_lock.Enter();
         distribute_free_regions();
+        if (decommit_thread_running_p)
+            decommit_lock.Leave();
         verify_region_to_generation_map ();
         compute_gc_and_ephemeral_range (settings.condemned_generation, true);
         stomp_write_barrier_ephemeral (ephemeral_low, ephemeral_high,
@@ -26136,11 +26701,60 @@ uint8_t* gc_heap::find_object (uint8_t* interior)
 
 #endif //MULTIPLE_HEAPS
 
+void gc_heap::clear_mark_type_stats()
+{
+    memset (mark_type_stats_table, 0, sizeof (mark_type_stats_table));
+    mark_type_stats_countdown = MARK_TYPE_STATS_SAMPLE_INTERVAL;
+}
+
+void gc_heap::record_mark_type_sample (uint8_t* o)
+{
+    uint8_t* mt = (uint8_t*)method_table (o);
+    size_t obj_size = size (o);
+
+    // Linear probe a few slots and give up if the table is too crowded - dropping
+    // samples only skews the composition a little.
+    size_t hash = ((size_t)mt) >> 6;
+    for (int probe = 0; probe < 8; probe++)
+    {
+        mark_type_stats_entry* entry = &mark_type_stats_table[(hash + probe) & (MARK_TYPE_STATS_TABLE_SIZE - 1)];
+        if (entry->method_table == mt)
+        {
+            entry->sampled_bytes += obj_size;
+            entry->sampled_objects++;
+            return;
+        }
+        if (entry->method_table == 0)
+        {
+            entry->method_table = mt;
+            entry->sampled_bytes = obj_size;
+            entry->sampled_objects = 1;
+            return;
+        }
+    }
+}
+
+inline
+void gc_heap::sample_marked_object (uint8_t* o)
+{
+    // keep the common path to a single predictable decrement and branch - this runs
+    // for every newly marked object.
+    if (--mark_type_stats_countdown == 0)
+    {
+        mark_type_stats_countdown = MARK_TYPE_STATS_SAMPLE_INTERVAL;
+        record_mark_type_sample (o);
+    }
+}
+
 inline
 BOOL gc_heap::gc_mark1 (uint8_t* o)
 {
     BOOL marked = !marked (o);
     set_marked (o);
+    if (marked)
+    {
+        sample_marked_object (o);
+    }
     dprintf (3, ("*%zx*, newly marked: %d", (size_t)o, marked));
 #if defined(USE_REGIONS) && defined(_DEBUG)
     heap_segment* seg = seg_mapping_table_segment_of (o);
@@ -26203,6 +26817,7 @@ BOOL gc_heap::gc_mark (uint8_t* o, uint8_t* low, uint8_t* high, int condemned_ge
             return FALSE;
         }
         set_marked (o);
+        sample_marked_object (o);
         return TRUE;
     }
     return FALSE;
@@ -26255,6 +26870,7 @@ BOOL gc_heap::background_mark1 (uint8_t* o)
     {
         mark_array_set_marked (o);
         dprintf (4, ("n*%zx*n", (size_t)o));
+        sample_marked_object (o);
         return TRUE;
     }
     else
@@ -27318,6 +27934,15 @@ gc_heap::mark_object_simple (uint8_t** po THREAD_NUMBER_DCL)
 #ifndef MULTIPLE_HEAPS
     const int thread = 0;
 #endif //MULTIPLE_HEAPS
+
+#ifdef WKS_PARALLEL_MARK
+    if (wks_mark_active)
+    {
+        // tracing is deferred - just hand the object to the deques.
+        wks_mark_enqueue_root (o);
+        return;
+    }
+#endif //WKS_PARALLEL_MARK
     {
 #ifdef SNOOP_STATS
         snoop_stat.objects_checked_count++;
@@ -27409,6 +28034,403 @@ void gc_heap::drain_mark_queue ()
     }
 }
 
+#ifdef WKS_PARALLEL_MARK
+
+#define WKS_MARK_DEQUE_LENGTH (128 * 1024)
+#define MAX_WKS_MARK_WORKERS 7
+
+bool wks_mark_deque::initialize (size_t len)
+{
+    // the length must be a power of 2 so top/bottom can be used modulo it.
+    assert ((len & (len - 1)) == 0);
+    entries = new (nothrow) uint8_t* [len];
+    if (entries == nullptr)
+        return false;
+    length = len;
+    top = 0;
+    bottom = 0;
+    return true;
+}
+
+void wks_mark_deque::destroy()
+{
+    delete [] entries;
+    entries = nullptr;
+}
+
+bool wks_mark_deque::push_bottom (uint8_t* o)
+{
+    size_t b = bottom;
+    size_t t = VolatileLoad (&top);
+    if ((b - t) >= length)
+    {
+        return false;
+    }
+    entries[b & (length - 1)] = o;
+    // make the entry visible before publishing the new bottom to thieves.
+    VolatileStore ((size_t*)&bottom, b + 1);
+    return true;
+}
+
+uint8_t* wks_mark_deque::pop_bottom()
+{
+    size_t b = bottom;
+    if (b == VolatileLoadWithoutBarrier (&top))
+    {
+        // only the owner pushes so once we see the deque empty it stays empty.
+        return nullptr;
+    }
+    b--;
+    VolatileStore ((size_t*)&bottom, b);
+    // the store to bottom must be visible before top is re-read, otherwise
+    // a thief and the owner could both take the last element.
+    MemoryBarrier();
+    size_t t = VolatileLoad (&top);
+    if (b > t)
+    {
+        return entries[b & (length - 1)];
+    }
+    uint8_t* o = nullptr;
+    if (b == t)
+    {
+        // last element - race against thieves for it.
+        if (Interlocked::CompareExchange (&top, t + 1, t) == t)
+        {
+            o = entries[b & (length - 1)];
+        }
+        t++;
+    }
+    VolatileStore ((size_t*)&bottom, t);
+    return o;
+}
+
+uint8_t* wks_mark_deque::steal_top()
+{
+    while (true)
+    {
+        size_t t = VolatileLoad (&top);
+        MemoryBarrier();
+        size_t b = VolatileLoad (&bottom);
+        if (t >= b)
+        {
+            return nullptr;
+        }
+        uint8_t* o = entries[t & (length - 1)];
+        if (Interlocked::CompareExchange (&top, t + 1, t) == t)
+        {
+            return o;
+        }
+        // raced with another thief or with the owner taking the last
+        // element - reevaluate.
+    }
+}
+
+void gc_heap::wks_parallel_mark_init()
+{
+    wks_mark_worker_count = 0;
+
+    if (!GCConfig::GetWksParallelMark())
+        return;
+
+    int n_procs = (int)GCToOSInterface::GetTotalProcessorCount();
+    if (n_procs < 2)
+        return;
+
+    int worker_count = min (n_procs - 1, MAX_WKS_MARK_WORKERS);
+
+    wks_mark_deques = new (nothrow) wks_mark_deque [worker_count + 1];
+    wks_mark_stats = new (nothrow) wks_mark_worker_stats [worker_count + 1];
+    if ((wks_mark_deques == nullptr) || (wks_mark_stats == nullptr))
+        return;
+
+    for (int i = 0; i <= worker_count; i++)
+    {
+        if (!wks_mark_deques[i].initialize (WKS_MARK_DEQUE_LENGTH))
+            return;
+        wks_mark_stats[i].promoted_bytes = 0;
+        wks_mark_stats[i].slow = MAX_PTR;
+        wks_mark_stats[i].shigh = 0;
+        wks_mark_stats[i].min_overflow = MAX_PTR;
+        wks_mark_stats[i].max_overflow = 0;
+    }
+
+    if (!wks_mark_start_event.CreateManualEventNoThrow (FALSE))
+        return;
+    if (!wks_mark_done_event.CreateAutoEventNoThrow (FALSE))
+        return;
+
+    // terminate starts out set so a worker that gets past the start event
+    // before the first drain parks itself again.
+    wks_mark_terminate = TRUE;
+
+    for (int i = 1; i <= worker_count; i++)
+    {
+        if (!GCToEEInterface::CreateThread (wks_mark_worker_stub, (void*)(size_t)i, false, ".NET Wks GC Mark"))
+        {
+            // make do with however many workers we managed to create.
+            break;
+        }
+        wks_mark_worker_count = i;
+    }
+
+    dprintf (1, ("wks parallel mark initialized with %d workers", wks_mark_worker_count));
+}
+
+void gc_heap::wks_mark_worker_stub (void* context)
+{
+    int worker = (int)(size_t)context;
+
+    while (true)
+    {
+        uint32_t result = wks_mark_start_event.Wait (INFINITE, FALSE);
+        assert (result == WAIT_OBJECT_0);
+        UNREFERENCED_PARAMETER (result);
+
+        if (wks_mark_terminate)
+        {
+            // this round is already over but the start event hasn't been
+            // reset yet - don't go again.
+            GCToOSInterface::YieldThread (0);
+            continue;
+        }
+
+        wks_mark_work (worker);
+
+        if (Interlocked::Decrement (&wks_mark_workers_active) == 0)
+        {
+            wks_mark_done_event.Set();
+        }
+    }
+}
+
+inline
+bool gc_heap::wks_mark_claim (uint8_t* o, int condemned_gen)
+{
+#ifdef USE_REGIONS
+    if (!is_in_heap_range (o))
+        return false;
+    if ((condemned_gen != max_generation) && (get_region_gen_num (o) > condemned_gen))
+        return false;
+#else //USE_REGIONS
+    assert (condemned_gen == -1);
+    if (!((o >= gc_heap::gc_low) && (o < gc_heap::gc_high)))
+        return false;
+#endif //USE_REGIONS
+
+    if (marked (o))
+        return false;
+
+    // Like server GC marking this is a benign race - two workers can both see
+    // the object unmarked and both trace it, which at worst overcounts the
+    // promoted bytes slightly.
+    set_marked (o);
+    return true;
+}
+
+void gc_heap::wks_mark_enqueue_root (uint8_t* o)
+{
+    int condemned_gen =
+#ifdef USE_REGIONS
+        settings.condemned_generation;
+#else
+        -1;
+#endif //USE_REGIONS
+
+    if (wks_mark_claim (o, condemned_gen))
+    {
+        if (!wks_mark_deques[0].push_bottom (o))
+        {
+            // the GC thread's deque is full. The object is already marked, so
+            // record it in the overflow range and let process_mark_overflow
+            // rescan it after the drain - tracing inline here could recurse
+            // arbitrarily deep.
+            wks_mark_record_overflow (o, 0);
+        }
+    }
+}
+
+inline
+void gc_heap::wks_mark_record_overflow (uint8_t* o, int worker)
+{
+    wks_mark_worker_stats* stats = &wks_mark_stats[worker];
+
+    dprintf (3, ("wks mark deque overflow for object %zx", (size_t)o));
+
+    // account for the object here - process_mark_overflow only re-traces the
+    // children of marked objects in the overflow range, it doesn't count the
+    // object itself again.
+    size_t s = size (o);
+    stats->promoted_bytes += s;
+    if (o < stats->slow)
+        stats->slow = o;
+    if (o > stats->shigh)
+        stats->shigh = o;
+
+#ifdef USE_REGIONS
+    if (survived_per_region)
+    {
+        Interlocked::ExchangeAdd (&survived_per_region[get_basic_region_index_for_address (o)], s);
+    }
+#endif //USE_REGIONS
+
+    stats->min_overflow = min (stats->min_overflow, o);
+    stats->max_overflow = max (stats->max_overflow, o);
+}
+
+void gc_heap::wks_mark_trace (uint8_t* o, int worker)
+{
+    wks_mark_worker_stats* stats = &wks_mark_stats[worker];
+
+    int condemned_gen =
+#ifdef USE_REGIONS
+        settings.condemned_generation;
+#else
+        -1;
+#endif //USE_REGIONS
+
+    size_t s = size (o);
+    stats->promoted_bytes += s;
+    if (o < stats->slow)
+        stats->slow = o;
+    if (o > stats->shigh)
+        stats->shigh = o;
+
+#ifdef USE_REGIONS
+    if (survived_per_region)
+    {
+        Interlocked::ExchangeAdd (&survived_per_region[get_basic_region_index_for_address (o)], s);
+    }
+#endif //USE_REGIONS
+
+    if (contain_pointers_or_collectible (o))
+    {
+        go_through_object_cl (method_table(o), o, s, poo,
+                              {
+                                  uint8_t* oo = *poo;
+                                  if (wks_mark_claim (oo, condemned_gen))
+                                  {
+                                      if (!wks_mark_deques[worker].push_bottom (oo))
+                                      {
+                                          wks_mark_record_overflow (oo, worker);
+                                      }
+                                  }
+                              });
+    }
+}
+
+void gc_heap::wks_mark_work (int worker)
+{
+    int participants = wks_mark_worker_count + 1;
+
+    while (true)
+    {
+        uint8_t* o = wks_mark_deques[worker].pop_bottom();
+        if (o == nullptr)
+        {
+            for (int i = 1; i < participants; i++)
+            {
+                o = wks_mark_deques[(worker + i) % participants].steal_top();
+                if (o != nullptr)
+                    break;
+            }
+        }
+
+        if (o != nullptr)
+        {
+            wks_mark_trace (o, worker);
+            continue;
+        }
+
+        // no work found anywhere - negotiate termination.
+        Interlocked::Increment (&wks_mark_idle_count);
+        while (true)
+        {
+            if (wks_mark_terminate)
+                return;
+
+            bool any_work_p = false;
+            for (int i = 0; i < participants; i++)
+            {
+                if (!wks_mark_deques[i].is_empty())
+                {
+                    any_work_p = true;
+                    break;
+                }
+            }
+
+            if (any_work_p)
+            {
+                Interlocked::Decrement (&wks_mark_idle_count);
+                break;
+            }
+
+            if (wks_mark_idle_count == participants)
+            {
+                // every worker is idle and every deque is empty. A worker only
+                // goes idle once its own deque is empty and nobody pushes into
+                // another worker's deque, so marking has reached a fixpoint.
+                wks_mark_terminate = TRUE;
+                return;
+            }
+
+            YieldProcessor();
+        }
+    }
+}
+
+void gc_heap::wks_mark_drain()
+{
+    assert (wks_mark_active);
+
+    // anything promoted from here on (dependent handles etc) goes back
+    // through the sequential marking path.
+    wks_mark_active = FALSE;
+
+    wks_mark_idle_count = 0;
+    wks_mark_terminate = FALSE;
+    if (wks_mark_worker_count > 0)
+    {
+        wks_mark_workers_active = wks_mark_worker_count;
+        wks_mark_start_event.Set();
+    }
+
+    wks_mark_work (0);
+
+    if (wks_mark_worker_count > 0)
+    {
+        uint32_t result = wks_mark_done_event.Wait (INFINITE, FALSE);
+        assert (result == WAIT_OBJECT_0);
+        UNREFERENCED_PARAMETER (result);
+        wks_mark_start_event.Reset();
+    }
+
+    // merge the per worker stats now that all the workers are parked again.
+    for (int i = 0; i <= wks_mark_worker_count; i++)
+    {
+        wks_mark_worker_stats* stats = &wks_mark_stats[i];
+#if !defined(USE_REGIONS) || defined(_DEBUG)
+        g_promoted += stats->promoted_bytes;
+#endif //!USE_REGIONS || _DEBUG
+        if (stats->slow < slow)
+            slow = stats->slow;
+        if (stats->shigh > shigh)
+            shigh = stats->shigh;
+        // overflow ranges feed into the regular mark overflow processing,
+        // which scan_dependent_handles runs after we return.
+        min_overflow_address = min (min_overflow_address, stats->min_overflow);
+        max_overflow_address = max (max_overflow_address, stats->max_overflow);
+        stats->promoted_bytes = 0;
+        stats->slow = MAX_PTR;
+        stats->shigh = 0;
+        stats->min_overflow = MAX_PTR;
+        stats->max_overflow = 0;
+    }
+
+    dprintf (3, ("wks parallel mark drained"));
+}
+
+#endif //WKS_PARALLEL_MARK
+
 #ifdef BACKGROUND_GC
 
 #ifdef USE_REGIONS
@@ -28995,6 +30017,8 @@ void gc_heap::mark_phase (int condemned_gen_number)
     if (gen0_must_clear_bricks > 0)
         gen0_must_clear_bricks--;
 
+    clear_mark_type_stats();
+
     size_t last_promoted_bytes = 0;
     size_t current_promoted_bytes = 0;
 #if !defined(USE_REGIONS) || defined(_DEBUG)
@@ -29179,8 +30203,29 @@ void gc_heap::mark_phase (int condemned_gen_number)
         slow  = MAX_PTR;
 #endif //MULTIPLE_HEAPS
 
+#ifdef WKS_PARALLEL_MARK
+        BOOL wks_parallel_p = (wks_mark_worker_count > 0);
+#ifdef HEAP_ANALYZE
+        if (heap_analyze_enabled)
+        {
+            wks_parallel_p = FALSE;
+        }
+#endif //HEAP_ANALYZE
+        if (wks_parallel_p)
+        {
+            // Tracing is deferred to the work-stealing deques which don't
+            // build the mark list - force the overflow path so the plan
+            // phase doesn't rely on it.
+            mark_list_end = &mark_list [0];
+            mark_list_index = mark_list_end + 1;
+        }
+#endif //WKS_PARALLEL_MARK
+
         if ((condemned_gen_number == max_generation) && (num_sizedrefs > 0))
         {
+            // Note: parallel marking is not active yet - sized ref handles
+            // measure their retained size via the promoted byte count around
+            // each Promote callback, which deferred tracing would break.
             GCScan::GcScanSizedRefs(GCHeap::Promote, condemned_gen_number, max_generation, &sc);
             drain_mark_queue();
             fire_mark_event (ETW::GC_ROOT_SIZEDREF, current_promoted_bytes, last_promoted_bytes);
@@ -29201,6 +30246,13 @@ void gc_heap::mark_phase (int condemned_gen_number)
             }
         }
 
+#ifdef WKS_PARALLEL_MARK
+        if (wks_parallel_p)
+        {
+            wks_mark_active = TRUE;
+        }
+#endif //WKS_PARALLEL_MARK
+
 #if defined(FEATURE_BASICFREEZE) && !defined(USE_REGIONS)
         if (ro_segments_in_range)
         {
@@ -29364,6 +30416,14 @@ void gc_heap::mark_phase (int condemned_gen_number)
     }
 #endif //MH_SC_MARK
 
+#ifdef WKS_PARALLEL_MARK
+    if (wks_mark_active)
+    {
+        wks_mark_drain();
+        fire_mark_event (ETW::GC_ROOT_STEAL, current_promoted_bytes, last_promoted_bytes);
+    }
+#endif //WKS_PARALLEL_MARK
+
     // Dependent handles need to be scanned with a special algorithm (see the header comment on
     // scan_dependent_handles for more detail). We perform an initial scan without synchronizing with other
     // worker threads or processing any mark stack overflow. This is not guaranteed to complete the operation
@@ -31902,6 +32962,8 @@ void gc_heap::plan_phase (int condemned_gen_number)
 #ifndef MULTIPLE_HEAPS
 #ifdef USE_VXSORT
         do_vxsort (mark_list, mark_list_index - mark_list, slow, shigh);
+#elif defined(USE_PACKED_SORT)
+        do_packed_sort (mark_list, mark_list_index - mark_list, slow, shigh);
 #else //USE_VXSORT
         _sort (&mark_list[0], mark_list_index - 1, 0);
 #endif //USE_VXSORT
@@ -32058,6 +33120,7 @@ void gc_heap::plan_phase (int condemned_gen_number)
     memset (planned_regions_per_gen, 0, sizeof (planned_regions_per_gen));
     memset (sip_maxgen_regions_per_gen, 0, sizeof (sip_maxgen_regions_per_gen));
     memset (reserved_free_regions_sip, 0, sizeof (reserved_free_regions_sip));
+    maxgen_compact_region_count = 0;
     int pinned_survived_region = 0;
     uint8_t** mark_list_index = nullptr;
     uint8_t** mark_list_next = nullptr;
@@ -34541,6 +35604,26 @@ bool gc_heap::should_sweep_in_plan (heap_segment* region)
         }
     }
 
+    if (!sip_p && (incremental_compact_maxgen_regions != 0) && (gen_num == max_generation))
+    {
+        // incremental compaction mode - only relocate up to incremental_compact_maxgen_regions
+        // gen2 regions per GC and sweep the rest in place. The swept regions stay in gen2 and
+        // are considered again at the next gen2 GC, so fragmentation is paid down a bounded
+        // slice at a time instead of in one monster compaction.
+        if (maxgen_compact_region_count < incremental_compact_maxgen_regions)
+        {
+            maxgen_compact_region_count++;
+        }
+        else
+        {
+            assert (new_gen_num == max_generation);
+            set_region_plan_gen_num (region, new_gen_num);
+            sip_p = true;
+            dprintf (REGIONS_LOG, ("region %p over the compact budget (%d), SIP instead",
+                heap_segment_mem (region), incremental_compact_maxgen_regions));
+        }
+    }
+
     if (sip_p)
     {
         if ((new_gen_num < max_generation) &&
@@ -35807,6 +36890,13 @@ void gc_heap::relocate_survivors_in_brick (uint8_t* tree, relocate_args* args)
         (tree + node_right_child (tree)),
         node_gap_size (tree)));
 
+    if (node_right_child (tree))
+    {
+        // see compact_in_brick - hide the pointer chase to the right child behind
+        // the relocation work for the current plug.
+        Prefetch (tree + node_right_child (tree));
+    }
+
     if (node_left_child (tree))
     {
         relocate_survivors_in_brick (tree + node_left_child (tree), args);
@@ -36743,6 +37833,13 @@ void gc_heap::compact_in_brick (uint8_t* tree, compact_args* args)
 
     args->print();
 
+    if (right_node)
+    {
+        // we won't get to the right child until after the current plug is processed -
+        // start bringing its node in now since the traversal is pure pointer chasing.
+        Prefetch (tree + right_node);
+    }
+
     if (left_node)
     {
         dprintf (3, ("B: L: %d->%p", left_node, (tree + left_node)));
@@ -36788,6 +37885,11 @@ void gc_heap::compact_in_brick (uint8_t* tree, compact_args* args)
     args->last_plug_relocation = relocation;
     args->is_shortened = has_post_plug_info_p;
 
+    // this plug is only copied once the next plug (or the end of the segment) is
+    // encountered; warm up its destination now as that's a guaranteed cache miss
+    // the copy would otherwise eat.
+    Prefetch (plug + relocation);
+
     if (right_node)
     {
         dprintf (3, ("B: R: %d->%p", right_node, (tree + right_node)));
@@ -37017,6 +38119,20 @@ void gc_heap::bgc_thread_stub (void* arg)
     gc_heap* heap = (gc_heap*)arg;
     heap->bgc_thread = GCToEEInterface::GetThread();
     assert(heap->bgc_thread != nullptr);
+#ifdef MULTIPLE_HEAPS
+    if (!gc_thread_no_affinitize_p)
+    {
+        // Give the BGC thread the same ideal processor as its heap's GC thread so the
+        // scheduler keeps it on the heap's NUMA node. We don't hard-affinitize it the
+        // way gc_thread_stub does because BGC work runs concurrently with user code.
+        uint16_t proc_no = heap_select::find_proc_no_from_heap_no (heap->heap_number);
+        uint16_t current_proc_no;
+        if (GCToOSInterface::GetCurrentThreadIdealProc (&current_proc_no))
+        {
+            GCToOSInterface::SetCurrentThreadIdealAffinity (current_proc_no, proc_no);
+        }
+    }
+#endif //MULTIPLE_HEAPS
     heap->bgc_thread_function();
 }
 #ifdef _MSC_VER
@@ -37678,6 +38794,8 @@ void gc_heap::background_mark_phase ()
     background_uoh_alloc_count = 0;
     bgc_overflow_count = 0;
 
+    clear_mark_type_stats();
+
     bpromoted_bytes (heap_number) = 0;
     static uint32_t num_sizedrefs = 0;
 
@@ -39020,7 +40138,9 @@ void gc_heap::bgc_thread_function()
             // at once.
             dprintf (1, ("GC thread timeout"));
             bgc_threads_timeout_cs.Enter();
-            if (!keep_bgc_threads_p)
+            // if the thread was created at init time we paid its creation cost on purpose
+            // so we never give it up.
+            if (!keep_bgc_threads_p && !bgc_prespawn_threads_p)
             {
                 dprintf (2, ("GC thread exiting"));
                 bgc_thread_running = FALSE;
@@ -40529,6 +41649,102 @@ uint8_t* gc_heap::find_first_object (uint8_t* start, uint8_t* first_object)
     return o;
 }
 
+#ifdef USE_VXSORT
+#include <immintrin.h>
+#include "vxsort/vxsort_targets_enable_avx2.h"
+static uint32_t* find_first_set_card_word_avx2 (uint32_t* card_word, uint32_t* card_word_end)
+{
+    // test a whole cache line of card words (64 bytes, 512 cards) per iteration.
+    while ((card_word + 16) <= card_word_end)
+    {
+        __m256i w0 = _mm256_loadu_si256 ((const __m256i*)card_word);
+        __m256i w1 = _mm256_loadu_si256 ((const __m256i*)(card_word + 8));
+        __m256i all = _mm256_or_si256 (w0, w1);
+        if (!_mm256_testz_si256 (all, all))
+            break;
+        card_word += 16;
+    }
+    return card_word;
+}
+
+static uint32_t* find_first_not_full_card_word_avx2 (uint32_t* card_word, uint32_t* card_word_end)
+{
+    __m256i all_set = _mm256_set1_epi32 (~0);
+    while ((card_word + 16) <= card_word_end)
+    {
+        __m256i w0 = _mm256_loadu_si256 ((const __m256i*)card_word);
+        __m256i w1 = _mm256_loadu_si256 ((const __m256i*)(card_word + 8));
+        // testc returns 1 iff the combined word has every card bit set
+        if (!_mm256_testc_si256 (_mm256_and_si256 (w0, w1), all_set))
+            break;
+        card_word += 16;
+    }
+    return card_word;
+}
+#include "vxsort/vxsort_targets_disable.h"
+#endif //USE_VXSORT
+
+// Returns a pointer to the first card word in [card_word, card_word_end) that has
+// a card set, or card_word_end if the whole span is clear. Clean spans dominate
+// card scanning on large heaps with sparse cross generation writes so it pays to
+// test them in cache line sized chunks with SIMD where available; the trailing
+// scalar loop handles the remainder (and everything when there's no SIMD path).
+inline
+static uint32_t* find_first_set_card_word (uint32_t* card_word, uint32_t* card_word_end)
+{
+#if defined(USE_VXSORT)
+    if (IsSupportedInstructionSet (InstructionSet::AVX2))
+    {
+        card_word = find_first_set_card_word_avx2 (card_word, card_word_end);
+    }
+#elif defined(TARGET_ARM64)
+    // NEON is baseline on arm64.
+    while ((card_word + 16) <= card_word_end)
+    {
+        uint32x4_t w01 = vorrq_u32 (vld1q_u32 (card_word), vld1q_u32 (card_word + 4));
+        uint32x4_t w23 = vorrq_u32 (vld1q_u32 (card_word + 8), vld1q_u32 (card_word + 12));
+        if (vmaxvq_u32 (vorrq_u32 (w01, w23)) != 0)
+            break;
+        card_word += 16;
+    }
+#endif //USE_VXSORT
+
+    while ((card_word < card_word_end) && !(*card_word))
+    {
+        card_word++;
+    }
+    return card_word;
+}
+
+// The counterpart of find_first_set_card_word for fully set spans - returns a
+// pointer to the first card word in [card_word, card_word_end) that is not
+// 0xffffffff, or card_word_end if they all are.
+inline
+static uint32_t* find_first_not_full_card_word (uint32_t* card_word, uint32_t* card_word_end)
+{
+#if defined(USE_VXSORT)
+    if (IsSupportedInstructionSet (InstructionSet::AVX2))
+    {
+        card_word = find_first_not_full_card_word_avx2 (card_word, card_word_end);
+    }
+#elif defined(TARGET_ARM64)
+    while ((card_word + 16) <= card_word_end)
+    {
+        uint32x4_t w01 = vandq_u32 (vld1q_u32 (card_word), vld1q_u32 (card_word + 4));
+        uint32x4_t w23 = vandq_u32 (vld1q_u32 (card_word + 8), vld1q_u32 (card_word + 12));
+        if (vminvq_u32 (vandq_u32 (w01, w23)) != ~0u)
+            break;
+        card_word += 16;
+    }
+#endif //USE_VXSORT
+
+    while ((card_word < card_word_end) && (*card_word == ~0u))
+    {
+        card_word++;
+    }
+    return card_word;
+}
+
 #ifdef CARD_BUNDLE
 // Find the first non-zero card word between cardw and cardw_end.
 // The index of the word we find is returned in cardw.
@@ -40563,10 +41779,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
 
             uint32_t* card_word = &card_table[max(card_bundle_cardw (cardb),cardw)];
             uint32_t* card_word_end = &card_table[min(card_bundle_cardw (cardb+1),cardw_end)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_first_set_card_word (card_word, card_word_end);
 
             if (card_word != card_word_end)
             {
@@ -40580,10 +41793,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
             }
             // explore the end of the card bundle so we can possibly clear it
             card_word_end = &card_table[card_bundle_cardw (cardb+1)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_first_set_card_word (card_word, card_word_end);
             if ((cardw <= card_bundle_cardw (cardb)) &&
                 (card_word == card_word_end))
             {
@@ -40600,18 +41810,12 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
     }
     else
     {
-        uint32_t* card_word = &card_table[cardw];
-        uint32_t* card_word_end = &card_table [cardw_end];
+        uint32_t* card_word = find_first_set_card_word (&card_table[cardw], &card_table [cardw_end]);
 
-        while (card_word < card_word_end)
+        if (card_word < &card_table [cardw_end])
         {
-            if ((*card_word) != 0)
-            {
-                cardw = (card_word - &card_table [0]);
-                return TRUE;
-            }
-
-            card_word++;
+            cardw = (card_word - &card_table [0]);
+            return TRUE;
         }
         return FALSE;
 
@@ -40671,12 +41875,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 #else //CARD_BUNDLE
         // Go through the remaining card words between here and card_word_end until we find
         // one that is non-zero.
-        do
-        {
-            ++last_card_word;
-        }
-
-        while ((last_card_word < &card_table [card_word_end]) && !(*last_card_word));
+        last_card_word = find_first_set_card_word (last_card_word + 1, &card_table [card_word_end]);
         if (last_card_word < &card_table [card_word_end])
         {
             card_word_value = *last_card_word;
@@ -40713,11 +41912,8 @@ BOOL gc_heap::find_card(uint32_t* card_table,
         // or we reach card_word_end.
         if ((bit_position == card_word_width) && (last_card_word < &card_table [card_word_end-1]))
         {
-            do
-            {
-                card_word_value = *(++last_card_word);
-            } while ((last_card_word < &card_table [card_word_end-1]) &&
-                     (card_word_value == ~0u /* (1 << card_word_width)-1 */));
+            last_card_word = find_first_not_full_card_word (last_card_word + 1, &card_table [card_word_end-1]);
+            card_word_value = *last_card_word;
             bit_position = 0;
         }
     } while (card_word_value & 1);
@@ -43923,6 +45119,70 @@ size_t gc_heap::decommit_region (heap_segment* region, int bucket, int h_number)
 
     return decommit_size;
 }
+
+// With GCConfig::GetDecommitThread() on, free regions queued on global_regions_to_decommit
+// are returned to the OS by a dedicated thread instead of being decommitted on the GC
+// thread (or, for workstation GC, inside the pause in distribute_free_regions). The
+// thread drains the queue in decommit_step sized batches so the decommit rate stays
+// limited to DECOMMIT_SIZE_PER_MILLISECOND, same as the gradual decommit done by the
+// server GC thread#0.
+void gc_heap::init_decommit_thread()
+{
+    assert (!decommit_thread_running_p);
+
+    if (!GCConfig::GetDecommitThread())
+    {
+        return;
+    }
+
+    if (!decommit_thread_wake_event.CreateAutoEventNoThrow (FALSE))
+    {
+        return;
+    }
+
+    if (!GCToEEInterface::CreateThread (decommit_thread_stub, 0, false, ".NET GC Decommit"))
+    {
+        decommit_thread_wake_event.CloseEvent();
+        return;
+    }
+
+    decommit_thread_running_p = true;
+}
+
+void gc_heap::wake_decommit_thread()
+{
+    assert (decommit_thread_running_p);
+    decommit_thread_wake_event.Set();
+}
+
+void gc_heap::decommit_thread_stub (void* context)
+{
+    decommit_thread_function();
+}
+
+void gc_heap::decommit_thread_function()
+{
+    while (true)
+    {
+        uint32_t wait_result = decommit_thread_wake_event.Wait (INFINITE, FALSE);
+        assert (wait_result == WAIT_OBJECT_0);
+
+        bool more_to_decommit_p = true;
+        while (more_to_decommit_p)
+        {
+            // the lock keeps us out of the way of a GC redistributing free regions
+            // and of the server GC thread#0 doing its own gradual decommit.
+            decommit_lock.Enter();
+            more_to_decommit_p = decommit_step (DECOMMIT_TIME_STEP_MILLISECONDS);
+            decommit_lock.Leave();
+
+            if (more_to_decommit_p)
+            {
+                GCToOSInterface::Sleep (DECOMMIT_TIME_STEP_MILLISECONDS);
+            }
+        }
+    }
+}
 #endif //USE_REGIONS
 
 #ifdef MULTIPLE_HEAPS
@@ -47092,6 +48352,12 @@ gc_heap::verify_free_lists ()
         {
             uint8_t* free_list = gen_alloc->alloc_list_head_of (a_l_number);
             uint8_t* prev = 0;
+            if (free_list && (gen_alloc->next_non_empty_bucket (a_l_number) != a_l_number))
+            {
+                dprintf (1, ("Verifiying Heap: bucket %u has free list items but is marked empty",
+                             a_l_number));
+                FATAL_GC_ERROR();
+            }
             while (free_list)
             {
                 if (!((CObjectHeader*)free_list)->IsFree())
@@ -48152,6 +49418,13 @@ HRESULT GCHeap::Initialize()
 
 #ifdef USE_REGIONS
     gc_heap::enable_special_regions_p = (bool)GCConfig::GetGCEnableSpecialRegions();
+    gc_heap::incremental_compact_maxgen_regions = (int)GCConfig::GetIncrementalCompactRegions();
+    if (gc_heap::incremental_compact_maxgen_regions != 0)
+    {
+        // incremental compaction keeps the over budget gen2 regions in place by
+        // sweeping them in plan, so it needs the special regions support.
+        gc_heap::enable_special_regions_p = true;
+    }
     size_t gc_region_size = (size_t)GCConfig::GetGCRegionSize();
 
     if (gc_region_size >= MAX_REGION_SIZE)
@@ -48378,6 +49651,23 @@ HRESULT GCHeap::Initialize()
 
         GCToEEInterface::DiagUpdateGenerationBounds();
 
+#ifdef BACKGROUND_GC
+        // Create the BGC threads up front if we are asked to - they will park on
+        // bgc_start_event until the first BGC is triggered, so that triggering one
+        // never pays thread creation cost inside the initial suspension window.
+        if (gc_heap::gc_can_use_concurrent && gc_heap::bgc_prespawn_threads_p)
+        {
+#ifdef MULTIPLE_HEAPS
+            for (int i = 0; i < gc_heap::n_heaps; i++)
+            {
+                gc_heap::g_heaps[i]->prepare_bgc_thread (gc_heap::g_heaps[i]);
+            }
+#else
+            gc_heap::prepare_bgc_thread (0);
+#endif //MULTIPLE_HEAPS
+        }
+#endif //BACKGROUND_GC
+
 #if defined(STRESS_REGIONS) && defined(FEATURE_BASICFREEZE)
 #ifdef MULTIPLE_HEAPS
         gc_heap* hp = gc_heap::g_heaps[0];
@@ -50106,6 +51396,7 @@ void gc_heap::do_post_gc()
     {
         fire_committed_usage_event ();
     }
+    fire_heap_type_stats_event ();
     GCHeap::UpdatePostGCCounters();
 
     // We need to reinitialize the number of pinned objects because it's used in the GCHeapStats
@@ -50662,6 +51953,17 @@ int GCHeap::SetGcLatencyMode (int newLatencyMode)
     return (int)set_pause_mode_success;
 }
 
+void GCHeap::SetPauseBudget (uint64_t pauseBudgetMSec)
+{
+    dprintf (1, ("host set pause budget to %zdms", (size_t)pauseBudgetMSec));
+    gc_heap::pause_budget_ms = pauseBudgetMSec;
+}
+
+size_t GCHeap::GetHeapTypeStatistics (GCHeapTypeStat* stats, size_t count)
+{
+    return gc_heap::get_mark_type_stats (stats, count);
+}
+
 int GCHeap::GetLOHCompactionMode()
 {
 #ifdef FEATURE_LOH_COMPACTION
@@ -50914,6 +52216,30 @@ Object* GCHeap::GetNextFinalizableObject()
 
 }
 
+size_t GCHeap::GetNextFinalizableObjects(Object** objs, size_t count)
+{
+#ifdef MULTIPLE_HEAPS
+
+    size_t fetched = 0;
+    //fetch the non critical ones from all queues first so a batch observes the
+    //same ordering as repeated GetNextFinalizableObject calls.
+    for (int hn = 0; (hn < gc_heap::n_heaps) && (fetched < count); hn++)
+    {
+        gc_heap* hp = gc_heap::g_heaps [hn];
+        fetched += hp->finalize_queue->GetNextFinalizableObjects((objs + fetched), (count - fetched), TRUE);
+    }
+    for (int hn = 0; (hn < gc_heap::n_heaps) && (fetched < count); hn++)
+    {
+        gc_heap* hp = gc_heap::g_heaps [hn];
+        fetched += hp->finalize_queue->GetNextFinalizableObjects((objs + fetched), (count - fetched), FALSE);
+    }
+    return fetched;
+
+#else //MULTIPLE_HEAPS
+    return pGenGCHeap->finalize_queue->GetNextFinalizableObjects(objs, count);
+#endif //MULTIPLE_HEAPS
+}
+
 size_t GCHeap::GetNumberFinalizableObjects()
 {
 #ifdef MULTIPLE_HEAPS
@@ -51208,6 +52534,34 @@ CFinalize::GetNextFinalizableObject (BOOL only_non_critical)
     return obj;
 }
 
+size_t
+CFinalize::GetNextFinalizableObjects (Object** objs, size_t count, BOOL only_non_critical)
+{
+    size_t fetched = 0;
+    EnterFinalizeLock();
+
+    while ((fetched < count) && !IsSegEmpty(FinalizerListSeg))
+    {
+        objs[fetched++] = *(--SegQueueLimit (FinalizerListSeg));
+    }
+    if (!only_non_critical)
+    {
+        while ((fetched < count) && !IsSegEmpty(CriticalFinalizerListSeg))
+        {
+            //the FinalizerList is empty, we can adjust both
+            // limit instead of moving the object to the free list
+            objs[fetched++] = *(--SegQueueLimit (CriticalFinalizerListSeg));
+            --SegQueueLimit (FinalizerListSeg);
+        }
+    }
+    if (fetched)
+    {
+        dprintf (3, ("fetched %zd objects for finalization", fetched));
+    }
+    LeaveFinalizeLock();
+    return fetched;
+}
+
 size_t
 CFinalize::GetNumberFinalizableObjects()
 {
@@ -52405,6 +53759,22 @@ bool gc_heap::compute_memory_settings(bool is_initialization, uint32_t& nhp, uin
 
     m_high_memory_load_th = min ((high_memory_load_th + 5), v_high_memory_load_th);
 
+    heap_soft_limit = 0;
+    if (heap_hard_limit)
+    {
+        size_t soft_limit_from_config = (size_t)GCConfig::GetGCHeapSoftLimit();
+        uint32_t soft_limit_percent = (uint32_t)GCConfig::GetGCHeapSoftLimitPercent();
+        if (!soft_limit_from_config && (soft_limit_percent > 0) && (soft_limit_percent < 100))
+        {
+            soft_limit_from_config = (size_t)((uint64_t)heap_hard_limit * (uint64_t)soft_limit_percent / (uint64_t)100);
+        }
+        // the soft limit is only meaningful strictly below the hard limit
+        if (soft_limit_from_config && (soft_limit_from_config < heap_hard_limit))
+        {
+            heap_soft_limit = soft_limit_from_config;
+        }
+    }
+
     return true;
 }
 
@@ -220,34 +220,14 @@ void record_global_mechanism (int mech_index);
 
 struct alloc_context : gc_alloc_context
 {
-#ifdef FEATURE_SVR_GC
-    inline SVR::GCHeap* get_alloc_heap()
-    {
-        return static_cast<SVR::GCHeap*>(gc_reserved_1);
-    }
-
-    inline void set_alloc_heap(SVR::GCHeap* heap)
-    {
-        gc_reserved_1 = heap;
-    }
-
-    inline SVR::GCHeap* get_home_heap()
-    {
-        return static_cast<SVR::GCHeap*>(gc_reserved_2);
-    }
-
-    inline void set_home_heap(SVR::GCHeap* heap)
-    {
-        gc_reserved_2 = heap;
-    }
-
     // How the alloc_count field is organized -
-    // 
+    //
     // high 16-bits are for the handle info, out of which
-    // high 10 bits store the cpu index. 
+    // high 10 bits store the cpu index.
     // low 6 bits store the number of handles allocated so far (before the next reset).
-    // 
-    // low 16-bits are for the actual alloc_count used by balance_heaps
+    //
+    // low 16-bits are for the actual alloc_count used by balance_heaps and the
+    // refill quantum scaling
     inline void init_alloc_count()
     {
         alloc_count &= 0xffff0000;
@@ -269,6 +249,27 @@ struct alloc_context : gc_alloc_context
         alloc_count = (high_16_bits << 16) | low_16_bits;
     }
 
+#ifdef FEATURE_SVR_GC
+    inline SVR::GCHeap* get_alloc_heap()
+    {
+        return static_cast<SVR::GCHeap*>(gc_reserved_1);
+    }
+
+    inline void set_alloc_heap(SVR::GCHeap* heap)
+    {
+        gc_reserved_1 = heap;
+    }
+
+    inline SVR::GCHeap* get_home_heap()
+    {
+        return static_cast<SVR::GCHeap*>(gc_reserved_2);
+    }
+
+    inline void set_home_heap(SVR::GCHeap* heap)
+    {
+        gc_reserved_2 = heap;
+    }
+
     inline void init_handle_info()
     {
         // Start the handle table index based on the AC value to make it random. There may have been handles
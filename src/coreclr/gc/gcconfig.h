@@ -82,9 +82,15 @@ public:
     INT_CONFIG   (LOHThreshold,              "GCLOHThreshold",            "System.GC.LOHThreshold",            LARGE_OBJECT_SIZE,  "Specifies the size that will make objects go on LOH")                                    \
     INT_CONFIG   (BGCSpinCount,              "BGCSpinCount",              NULL,                                140,                "Specifies the bgc spin count")                                                           \
     INT_CONFIG   (BGCSpin,                   "BGCSpin",                   NULL,                                2,                  "Specifies the bgc spin time")                                                            \
+    BOOL_CONFIG  (BGCPrespawnThreads,        "BGCPrespawnThreads",        NULL,                                false,              "Creates the background GC threads at GC init instead of when the first background GC "  \
+                                                                                                                                          "is triggered")                                                                           \
+    BOOL_CONFIG  (AffinityPacking,           "GCAffinityPacking",         NULL,                                false,              "When compacting into gen2 free list holes, prefers the hole nearest the previous "      \
+                                                                                                                                          "plug's destination so related plugs stay close together")                               \
     INT_CONFIG   (HeapCount,                 "GCHeapCount",               "System.GC.HeapCount",               0,                  "Specifies the number of server GC heaps")                                                 \
     INT_CONFIG   (MaxHeapCount,              "GCMaxHeapCount",            "System.GC.MaxHeapCount",            0,                  "Specifies the max number of server GC heaps to adjust to")                                                 \
     INT_CONFIG   (Gen0Size,                  "GCgen0size",                NULL,                                0,                  "Specifies the smallest gen0 budget")                                                     \
+    INT_CONFIG   (AllocContextRefillMaxScale, "GCAllocContextRefillMaxScale", NULL,                            4,                  "Specifies the largest multiple of the allocation quantum that the refill size of a "     \
+                                                                                                                                          "frequently refilled allocation context can grow to")                                     \
     INT_CONFIG   (SegmentSize,               "GCSegmentSize",             NULL,                                0,                  "Specifies the managed heap segment size")                                                \
     INT_CONFIG   (LatencyMode,               "GCLatencyMode",             NULL,                                -1,                 "Specifies the GC latency mode - batch, interactive or low latency (note that the same "   \
                                                                                                                                            "thing can be specified via API which is the supported way")                             \
@@ -139,7 +145,13 @@ public:
     INT_CONFIG   (GCWriteBarrier,            "GCWriteBarrier",            NULL,                                0,                  "Specifies whether GC should use more precise but slower write barrier")                  \
     STRING_CONFIG(GCName,                    "GCName",                    "System.GC.Name",                                        "Specifies the path of the standalone GC implementation.")                                \
     INT_CONFIG   (GCSpinCountUnit,           "GCSpinCountUnit",           NULL,                                0,                  "Specifies the spin count unit used by the GC.")                                          \
-    INT_CONFIG   (GCDynamicAdaptationMode,   "GCDynamicAdaptationMode",   "System.GC.DynamicAdaptationMode",   0,                  "Enable the GC to dynamically adapt to application sizes.")
+    INT_CONFIG   (GCDynamicAdaptationMode,   "GCDynamicAdaptationMode",   "System.GC.DynamicAdaptationMode",   0,                  "Enable the GC to dynamically adapt to application sizes.")                               \
+    BOOL_CONFIG  (WksParallelMark,           "GCWksParallelMark",         "System.GC.WksParallelMark",         false,              "Enables work-stealing parallel marking for workstation GC")                              \
+    BOOL_CONFIG  (DecommitThread,            "GCDecommitThread",          "System.GC.DecommitThread",          false,              "Uses a dedicated thread to decommit free regions in the background")                     \
+    INT_CONFIG   (IncrementalCompactRegions, "GCIncrementalCompactRegions", "System.GC.IncrementalCompactRegions", 0,              "Limits how many gen2 regions a compacting GC may relocate - 0 means no limit")           \
+    INT_CONFIG   (GCHeapSoftLimit,           "GCHeapSoftLimit",           "System.GC.HeapSoftLimit",           0,                  "Specifies a soft limit for the GC heap below the hard limit")                            \
+    INT_CONFIG   (GCHeapSoftLimitPercent,    "GCHeapSoftLimitPercent",    "System.GC.HeapSoftLimitPercent",    0,                  "Specifies the soft limit as a percentage of the hard limit")                \
+    INT_CONFIG   (GCPauseBudget,             "GCPauseBudget",             "System.GC.PauseBudget",             0,                  "Specifies a rolling pause budget in milliseconds the GC tries to honor when selecting the condemned generation")
 // This class is responsible for retreiving configuration information
 // for how the GC should operate.
 class GCConfig
@@ -102,6 +102,14 @@ OBJECTHANDLE GCHandleStore::CreateDependentHandle(Object* primary, Object* secon
     return handle;
 }
 
+uint32_t GCHandleStore::CreateHandlesOfType(Object** pObjects, HandleType type, OBJECTHANDLE* pHandles, uint32_t count)
+{
+    // the whole batch goes into a single table - picking one per handle would defeat
+    // the amortization the bulk entrypoint provides.
+    HHANDLETABLE handletable = GetTable();
+    return ::HndCreateHandles(handletable, type, (OBJECTREF*)pObjects, pHandles, count);
+}
+
 GCHandleStore::~GCHandleStore()
 {
     ::Ref_DestroyHandleTableBucket(&_underlyingBucket);
@@ -222,3 +230,23 @@ void GCHandleManager::TraceRefCountedHandles(HANDLESCANPROC callback, uintptr_t
     ::Ref_TraceRefCountHandles(callback, param1, param2);
 }
 
+void GCHandleManager::DestroyHandlesOfType(OBJECTHANDLE* pHandles, uint32_t count, HandleType type)
+{
+    // handles created in a batch all live in the same table, but callers may mix
+    // batches (or individually created handles), so free them one run at a time.
+    uint32_t start = 0;
+    while (start < count)
+    {
+        HHANDLETABLE handletable = ::HndGetHandleTable(pHandles[start]);
+
+        uint32_t end = start + 1;
+        while ((end < count) && (::HndGetHandleTable(pHandles[end]) == handletable))
+        {
+            end++;
+        }
+
+        ::HndDestroyHandles(handletable, type, pHandles + start, end - start);
+        start = end;
+    }
+}
+
@@ -22,6 +22,8 @@ public:
 
     virtual OBJECTHANDLE CreateDependentHandle(Object* primary, Object* secondary);
 
+    virtual uint32_t CreateHandlesOfType(Object** pObjects, HandleType type, OBJECTHANDLE* pHandles, uint32_t count);
+
     virtual ~GCHandleStore();
 
     HandleTableBucket _underlyingBucket;
@@ -70,6 +72,8 @@ public:
     virtual HandleType HandleFetchType(OBJECTHANDLE handle);
 
     virtual void TraceRefCountedHandles(HANDLESCANPROC callback, uintptr_t param1, uintptr_t param2);
+
+    virtual void DestroyHandlesOfType(OBJECTHANDLE* pHandles, uint32_t count, HandleType type);
 };
 
 #endif  // GCHANDLETABLE_H_
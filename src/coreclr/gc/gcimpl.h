@@ -204,11 +204,14 @@ public:
     enable_no_gc_region_callback_status EnableNoGCRegionCallback(NoGCRegionCallbackFinalizerWorkItem* callback, uint64_t callback_threshold);
     FinalizerWorkItem* GetExtraWorkForFinalization();
     uint64_t GetGenerationBudget(int generation);
+    void SetPauseBudget(uint64_t pauseBudgetMSec);
+    size_t GetHeapTypeStatistics(GCHeapTypeStat* stats, size_t count);
 
     unsigned GetGcCount();
 
     Object* GetNextFinalizable() { return GetNextFinalizableObject(); };
     size_t GetNumberOfFinalizable() { return GetNumberFinalizableObjects(); }
+    size_t GetNextFinalizableObjects(Object** objs, size_t count);
 
     size_t GetValidSegmentSize(bool large_seg = false);
 
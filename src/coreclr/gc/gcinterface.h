@@ -11,7 +11,7 @@
 // The minor version of the IGCHeap interface. Non-breaking changes are required
 // to bump the minor version number. GCs and EEs with minor version number
 // mismatches can still interoperate correctly, with some care.
-#define GC_INTERFACE_MINOR_VERSION 2
+#define GC_INTERFACE_MINOR_VERSION 3
 
 // The major version of the IGCToCLR interface. Breaking changes to this interface
 // require bumps in the major version number.
@@ -546,6 +546,16 @@ public:
     virtual OBJECTHANDLE CreateDependentHandle(Object* primary, Object* secondary) PURE_VIRTUAL
 
     virtual ~IGCHandleStore() {};
+
+    // Creates a batch of handles of the given type, amortizing the handle table
+    // synchronization across the whole batch. Returns how many handles were created;
+    // on failure that may be less than count, and the caller is responsible for
+    // destroying the handles that were created.
+    //
+    // Added in 5.3 - must stay after the pre-existing virtuals (including the
+    // destructor) so their vtable slots keep their positions when running with
+    // an older standalone GC.
+    virtual uint32_t CreateHandlesOfType(Object** pObjects, HandleType type, OBJECTHANDLE* pHandles, uint32_t count) PURE_VIRTUAL
 };
 
 class IGCHandleManager {
@@ -586,6 +596,11 @@ public:
     virtual HandleType HandleFetchType(OBJECTHANDLE handle) PURE_VIRTUAL
 
     virtual void TraceRefCountedHandles(HANDLESCANPROC callback, uintptr_t param1, uintptr_t param2) PURE_VIRTUAL
+
+    // Destroys a batch of handles of the given type, amortizing the handle table
+    // synchronization across the whole batch. The handles need not all come from
+    // the same handle table.
+    virtual void DestroyHandlesOfType(OBJECTHANDLE* pHandles, uint32_t count, HandleType type) PURE_VIRTUAL
 };
 
 // Enum representing the type to be passed to GC.CoreCLR.cs used to deduce the type of configuration.
@@ -598,6 +613,18 @@ enum class GCConfigurationType
 
 using ConfigurationValueFunc = void (*)(void* context, void* name, void* publicKey, GCConfigurationType type, int64_t data);
 
+// One entry of the sampled per-type heap composition returned by
+// IGCHeap::GetHeapTypeStatistics.
+struct GCHeapTypeStat
+{
+    // The method table the sampled objects belong to.
+    void* methodTable;
+    // Total size of the sampled objects of this type.
+    uint64_t sampledByteCount;
+    // Number of sampled objects of this type.
+    uint64_t sampledObjectCount;
+};
+
 // IGCHeap is the interface that the VM will use when interacting with the GC.
 class IGCHeap {
 public:
@@ -1013,6 +1040,25 @@ public:
     virtual FinalizerWorkItem* GetExtraWorkForFinalization() PURE_VIRTUAL
 
     virtual uint64_t GetGenerationBudget(int generation) PURE_VIRTUAL
+
+    // Gets up to count finalizable objects, writing them to objs and returning how
+    // many were fetched. Equivalent to calling GetNextFinalizable that many times,
+    // but only synchronizes with the finalize queues once per batch.
+    virtual size_t GetNextFinalizableObjects(Object** objs, size_t count) PURE_VIRTUAL
+
+    // Sets a rolling pause budget, in milliseconds, that the GC attempts to honor when
+    // selecting the condemned generation: collections whose last recorded pause of the
+    // same kind exceeded the budget are demoted until the budget is relaxed again.
+    // Zero (the default) means no budget. Collections the GC considers compelling
+    // (induced full GCs, impending OOM) ignore the budget.
+    virtual void SetPauseBudget(uint64_t pauseBudgetMSec) PURE_VIRTUAL
+
+    // Fills stats with up to count entries describing the per-type composition of the
+    // objects marked by the most recently completed mark phase, aggregated across heaps,
+    // and returns the number of entries written. The counts come from sampling roughly
+    // one in every 128 newly marked objects, so they describe relative composition of
+    // the heap rather than exact sizes.
+    virtual size_t GetHeapTypeStatistics(GCHeapTypeStat* stats, size_t count) PURE_VIRTUAL
 };
 
 #ifdef WRITE_BARRIER_CHECK
@@ -204,6 +204,8 @@ inline void FATAL_GC_ERROR()
 #ifdef SERVER_GC
 #define MH_SC_MARK //scalable marking
 //#define SNOOP_STATS //diagnostic
+#else //SERVER_GC
+#define WKS_PARALLEL_MARK //opt-in work-stealing marking for workstation GC
 #endif //SERVER_GC
 
 //This is used to mark some type volatile only when the scalable marking is used.
@@ -750,6 +752,18 @@ struct etw_bucket_info
 };
 #endif //FEATURE_EVENT_TRACE
 
+// Sampled per-type statistics accumulated while objects are marked - see
+// gc_heap::sample_marked_object.
+#define MARK_TYPE_STATS_TABLE_SIZE (256)
+#define MARK_TYPE_STATS_SAMPLE_INTERVAL (128)
+
+struct mark_type_stats_entry
+{
+    uint8_t* method_table;
+    uint64_t sampled_bytes;
+    uint64_t sampled_objects;
+};
+
 #ifdef DYNAMIC_HEAP_COUNT
 struct min_fl_list_info
 {
@@ -771,10 +785,21 @@ class allocator
     alloc_list first_bucket;
     alloc_list* buckets;
     int gen_number;
+    // Bit n set means bucket n may contain free items, bit n clear means it is
+    // definitely empty (MAX_BUCKET_COUNT fits in 32 bits). Maintained wherever we
+    // thread/unlink items so allocate_in_older_generation can skip empty buckets
+    // instead of walking them - see first_suitable_non_empty_bucket.
+    uint32_t bucket_bitmap;
     alloc_list& alloc_list_of (unsigned int bn);
     size_t& alloc_list_damage_count_of (unsigned int bn);
     void thread_free_item_end (uint8_t* free_item, uint8_t*& head, uint8_t*& tail, int bn);
 
+    void set_bucket_bit (unsigned int bn)
+    {
+        bucket_bitmap |= ((uint32_t)1 << bn);
+    }
+    void clear_bucket_bit_if_empty (unsigned int bn);
+
 public:
     allocator (unsigned int num_b, int fbb, alloc_list* b, int gen=-1);
 
@@ -782,6 +807,7 @@ public:
     {
         num_buckets = 1;
         first_bucket_bits = sizeof(size_t) * 8 - 1;
+        bucket_bitmap = 0;
         // for young gens we just set it to 0 since we don't treat
         // them differently from each other
         gen_number = 0;
@@ -810,6 +836,33 @@ public:
         return min ((unsigned int)highest_set_bit_index, (num_buckets - 1));
     }
 
+    // same as first_suitable_bucket except it also skips buckets known to be empty,
+    // returning number_of_buckets() when no bucket that could fit "size" may have
+    // free items
+    unsigned int first_suitable_non_empty_bucket (size_t size)
+    {
+        return next_non_empty_bucket (first_suitable_bucket (size));
+    }
+
+    // returns the first bucket at or after bn that may contain free items,
+    // or number_of_buckets() if there is no such bucket
+    unsigned int next_non_empty_bucket (unsigned int bn)
+    {
+        if (bn >= num_buckets)
+            return num_buckets;
+
+        uint32_t non_empty_bits = (bucket_bitmap >> bn);
+        if (non_empty_bits == 0)
+            return num_buckets;
+
+        DWORD lowest_set_bit_index;
+        BitScanForward (&lowest_set_bit_index, non_empty_bits);
+
+        return (bn + (unsigned int)lowest_set_bit_index);
+    }
+
+    void recompute_bucket_bitmap();
+
     size_t first_bucket_size()
     {
         return ((size_t)1 << (first_bucket_bits + 1));
@@ -868,6 +921,8 @@ public:
 #endif
             alloc_list_head_of(i) = al->alloc_list_head();
         }
+
+        recompute_bucket_bitmap();
     }
 
     void unlink_item (unsigned int bn, uint8_t* item, uint8_t* previous_item, BOOL use_undo_p);
@@ -1448,6 +1503,52 @@ public:
 
 float median_of_3 (float a, float b, float c);
 
+#ifdef WKS_PARALLEL_MARK
+// A bounded work-stealing deque used by the opt-in parallel mark phase for
+// workstation GC. The owning worker pushes and pops at the bottom without
+// interlocked operations (except when taking the last element); thieves
+// take from the top with a CAS. top and bottom increase monotonically -
+// entries are indexed modulo the (power of 2) length.
+class wks_mark_deque
+{
+    VOLATILE(size_t) top;
+    VOLATILE(size_t) bottom;
+    uint8_t** entries;
+    size_t length;
+
+public:
+    bool initialize (size_t len);
+    void destroy();
+
+    // owner-only; returns false if the deque is full.
+    bool push_bottom (uint8_t* o);
+    // owner-only.
+    uint8_t* pop_bottom();
+    // can be called from any worker.
+    uint8_t* steal_top();
+
+    bool is_empty()
+    {
+        return (VolatileLoadWithoutBarrier (&bottom) <= VolatileLoadWithoutBarrier (&top));
+    }
+};
+
+// Per mark worker stats, merged on the GC thread once marking reaches a
+// fixpoint. Padded out to a cache line to avoid false sharing.
+struct wks_mark_worker_stats
+{
+    size_t promoted_bytes;
+    uint8_t* slow;
+    uint8_t* shigh;
+    // range of objects this worker marked but could not push because its deque
+    // was full; merged into min/max_overflow_address and rescanned by
+    // process_mark_overflow once the parallel phase is over.
+    uint8_t* min_overflow;
+    uint8_t* max_overflow;
+    uint8_t padding[64 - (sizeof (size_t) + 4 * sizeof (uint8_t*))];
+};
+#endif //WKS_PARALLEL_MARK
+
 //class definition of the internal class
 class gc_heap
 {
@@ -1578,6 +1679,20 @@ private:
 
     PER_HEAP_ISOLATED_METHOD void fire_committed_usage_event();
 
+    PER_HEAP_METHOD void clear_mark_type_stats();
+
+    // Samples roughly one in every MARK_TYPE_STATS_SAMPLE_INTERVAL newly marked
+    // objects into mark_type_stats_table.
+    PER_HEAP_METHOD void sample_marked_object (uint8_t* o);
+
+    PER_HEAP_METHOD void record_mark_type_sample (uint8_t* o);
+
+    // Merges the per-heap mark type stats tables into stats, up to count entries,
+    // and returns the number of entries written.
+    PER_HEAP_ISOLATED_METHOD size_t get_mark_type_stats (GCHeapTypeStat* stats, size_t count);
+
+    PER_HEAP_ISOLATED_METHOD void fire_heap_type_stats_event();
+
 #ifdef FEATURE_BASICFREEZE
     PER_HEAP_ISOLATED_METHOD void walk_read_only_segment(heap_segment *seg, void *pvContext, object_callback_func pfnMethodTable, object_callback_func pfnObjRef);
 #endif
@@ -2185,6 +2300,9 @@ private:
 
     PER_HEAP_METHOD size_t limit_from_size (size_t size, uint32_t flags, size_t room, int gen_number,
                             int align_const);
+    // Returns the refill quantum for this context - allocation_quantum scaled up by
+    // how many times the context has refilled, within the configured bound.
+    PER_HEAP_METHOD size_t get_alloc_context_quantum (alloc_context* acontext);
     PER_HEAP_METHOD allocation_state try_allocate_more_space (alloc_context* acontext, size_t jsize, uint32_t flags,
                                               int alloc_generation_number);
     PER_HEAP_ISOLATED_METHOD BOOL allocate_more_space (alloc_context* acontext, size_t jsize, uint32_t flags,
@@ -2368,11 +2486,19 @@ private:
     PER_HEAP_ISOLATED_METHOD bool decommit_step (uint64_t step_milliseconds);
 #ifdef USE_REGIONS
     PER_HEAP_ISOLATED_METHOD size_t decommit_region (heap_segment* region, int bucket, int h_number);
+    PER_HEAP_ISOLATED_METHOD void init_decommit_thread();
+    PER_HEAP_ISOLATED_METHOD void wake_decommit_thread();
+    PER_HEAP_ISOLATED_METHOD void decommit_thread_function();
+    PER_HEAP_ISOLATED_METHOD void decommit_thread_stub (void* context);
 #endif //USE_REGIONS
     PER_HEAP_METHOD void decommit_heap_segment (heap_segment* seg);
     PER_HEAP_ISOLATED_METHOD bool virtual_alloc_commit_for_heap (void* addr, size_t size, int h_number);
+#if !defined(MULTIPLE_HEAPS) && !defined(FEATURE_NATIVEAOT)
+    PER_HEAP_ISOLATED_METHOD void init_numa_node_map();
+#endif //!MULTIPLE_HEAPS && !FEATURE_NATIVEAOT
     PER_HEAP_ISOLATED_METHOD bool virtual_commit (void* address, size_t size, int bucket, int h_number=-1, bool* hard_limit_exceeded_p=NULL);
     PER_HEAP_ISOLATED_METHOD bool virtual_decommit (void* address, size_t size, int bucket, int h_number=-1);
+    PER_HEAP_ISOLATED_METHOD void check_heap_soft_limit();
     PER_HEAP_ISOLATED_METHOD void virtual_free (void* add, size_t size, heap_segment* sg=NULL);
     PER_HEAP_ISOLATED_METHOD void reset_memory(uint8_t* o, size_t sizeo);
     PER_HEAP_METHOD void clear_gen0_bricks();
@@ -2632,6 +2758,17 @@ private:
     PER_HEAP_METHOD void mark_steal ();
 #endif //MH_SC_MARK
 
+#ifdef WKS_PARALLEL_MARK
+    PER_HEAP_ISOLATED_METHOD void wks_parallel_mark_init();
+    PER_HEAP_ISOLATED_METHOD bool wks_mark_claim (uint8_t* o, int condemned_gen);
+    PER_HEAP_ISOLATED_METHOD void wks_mark_enqueue_root (uint8_t* o);
+    PER_HEAP_ISOLATED_METHOD void wks_mark_trace (uint8_t* o, int worker);
+    PER_HEAP_ISOLATED_METHOD void wks_mark_record_overflow (uint8_t* o, int worker);
+    PER_HEAP_ISOLATED_METHOD void wks_mark_work (int worker);
+    PER_HEAP_ISOLATED_METHOD void wks_mark_drain();
+    PER_HEAP_ISOLATED_METHOD void wks_mark_worker_stub (void* context);
+#endif //WKS_PARALLEL_MARK
+
 #ifdef BACKGROUND_GC
     PER_HEAP_METHOD BOOL background_marked (uint8_t* o);
     PER_HEAP_METHOD BOOL background_mark1 (uint8_t* o);
@@ -3418,6 +3555,21 @@ private:
 #else //MULTIPLE_HEAPS
     PER_HEAP_FIELD_SINGLE_GC uint8_t* shigh; //keeps track of the highest marked object
     PER_HEAP_FIELD_SINGLE_GC uint8_t* slow; //keeps track of the lowest marked object
+
+#ifdef WKS_PARALLEL_MARK
+    // State for the opt-in work-stealing parallel mark phase. The deque and
+    // stats arrays have (wks_mark_worker_count + 1) elements - index 0 belongs
+    // to the GC thread, the rest to the dedicated mark worker threads.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY int wks_mark_worker_count;
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY wks_mark_deque* wks_mark_deques;
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY wks_mark_worker_stats* wks_mark_stats;
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY GCEvent wks_mark_start_event;
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY GCEvent wks_mark_done_event;
+    PER_HEAP_ISOLATED_FIELD_SINGLE_GC VOLATILE(BOOL) wks_mark_active;
+    PER_HEAP_ISOLATED_FIELD_SINGLE_GC VOLATILE(BOOL) wks_mark_terminate;
+    PER_HEAP_ISOLATED_FIELD_SINGLE_GC VOLATILE(int32_t) wks_mark_idle_count;
+    PER_HEAP_ISOLATED_FIELD_SINGLE_GC VOLATILE(int32_t) wks_mark_workers_active;
+#endif //WKS_PARALLEL_MARK
 #endif //MULTIPLE_HEAPS
 
 #ifdef BACKGROUND_GC
@@ -3478,6 +3630,11 @@ private:
     PER_HEAP_FIELD_SINGLE_GC int sip_maxgen_regions_per_gen[max_generation + 1];
     PER_HEAP_FIELD_SINGLE_GC heap_segment* reserved_free_regions_sip[max_generation];
 
+    // Number of gen2 regions this heap has elected to relocate during this GC; only
+    // maintained when incremental_compact_maxgen_regions is non zero, in which case
+    // gen2 regions over that budget are swept in plan instead.
+    PER_HEAP_FIELD_SINGLE_GC int maxgen_compact_region_count;
+
     // Used to keep track of the total regions in each condemned generation. For SIP regions we need
     // to know if we've made all regions in a condemned gen into a max_generation region; if so we
     // would want to revert our decision so we leave at least one region in that generation. Otherwise
@@ -3621,6 +3778,11 @@ private:
     // calculated at the end of a GC and used in allocator
     PER_HEAP_FIELD_SINGLE_GC_ALLOC size_t allocation_quantum;
 
+    // allocation_quantum scaled for the context currently being refilled - computed
+    // at the start of each SOH refill while more_space_lock_soh is held and consumed
+    // by limit_from_size.
+    PER_HEAP_FIELD_SINGLE_GC_ALLOC size_t soh_refill_quantum;
+
     // TODO: actually a couple of entries in these elements are carried over from GC to GC -
     // collect_count and previous_time_clock. It'd be nice to isolate these out.
     // Only field used by allocation is new_allocation.
@@ -3687,14 +3849,12 @@ private:
     // These *alloc_list fields are init-ed once and used throughput process lifetime, they contained fields
     // that are maintained via these generations' free_list_allocator. LOH/POH's alloc_lists are also used
     // by the allocator so they are in the PER_HEAP_FIELD_MAINTAINED_ALLOC section.
-#define NUM_GEN2_ALIST (12)
-#ifdef HOST_64BIT
-    // bucket 0 contains sizes less than 256
-#define BASE_GEN2_ALIST_BITS (7)
-#else
+    // We use one more bucket than we used to, starting at a smaller size, so the
+    // common small sizes produced by fragmentation-heavy workloads each get their
+    // own size class instead of sharing the first-fit bucket 0.
+#define NUM_GEN2_ALIST (13)
     // bucket 0 contains sizes less than 128
 #define BASE_GEN2_ALIST_BITS (6)
-#endif //HOST_64BIT
     PER_HEAP_FIELD_MAINTAINED alloc_list gen2_alloc_list[NUM_GEN2_ALIST - 1];
 
 #ifdef BACKGROUND_GC
@@ -3862,6 +4022,13 @@ private:
 
     PER_HEAP_FIELD_DIAG_ONLY fgm_history fgm_result;
 
+    // Sampled per-type composition of the objects this heap marked during the most
+    // recent mark phase. This is a small open addressed hash table on the method
+    // table; samples whose type doesn't fit are simply dropped, which is acceptable
+    // for a sampled diagnostic.
+    PER_HEAP_FIELD_DIAG_ONLY mark_type_stats_entry mark_type_stats_table[MARK_TYPE_STATS_TABLE_SIZE];
+    PER_HEAP_FIELD_DIAG_ONLY size_t mark_type_stats_countdown;
+
     struct gc_history
     {
         size_t gc_index;
@@ -4194,9 +4361,23 @@ private:
     // maintained as we need to grow bookkeeping data.
     PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t card_table_element_layout[total_bookkeeping_elements + 1];
 
+    // How many times an allocation context's refill quantum may double as its refill
+    // count climbs, derived from GCConfig::GetAllocContextRefillMaxScale.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t alloc_context_refill_max_shift;
+
+    // Set from GCConfig at init. When set, allocate_in_older_generation picks the free
+    // list item nearest the previous plug's destination instead of the bucket head, so
+    // plugs that were adjacent (and tend to reference each other) stay close together.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY BOOL affinity_packing_p;
+
 #ifdef BACKGROUND_GC
     // Only matters if we need to timeout BGC threads
     PER_HEAP_ISOLATED_FIELD_MAINTAINED BOOL keep_bgc_threads_p;
+
+    // Set from GCConfig at init. When set we create the BGC threads during GC init and
+    // they never timeout, so triggering a BGC never pays thread creation cost inside
+    // its initial suspension window.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY BOOL bgc_prespawn_threads_p;
 #endif //BACKGROUND_GC
 
 #ifdef USE_REGIONS
@@ -4310,6 +4491,10 @@ private:
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY int generation_skip_ratio_threshold;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY int conserve_mem_setting;
 
+    // Rolling pause budget in milliseconds declared by the host via IGCHeap::SetPauseBudget,
+    // 0 means no budget. Can be changed by the host at any time.
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED VOLATILE(uint64_t) pause_budget_ms;
+
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool spin_count_unit_config_p;
 
     // For SOH we always allocate segments of the same size (except for segments when no_gc_region requires larger ones).
@@ -4378,10 +4563,34 @@ private:
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t heap_hard_limit;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t heap_hard_limit_oh[total_oh_count];
 
+    // Optional watermark strictly below heap_hard_limit. When committed bytes cross it
+    // we shrink gen0 allocation contexts proportionally and fire the
+    // HeapSoftLimitExceeded event so a host can shed load before the hard limit turns
+    // into OOM. 0 means no soft limit.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t heap_soft_limit;
+
+    // 1 while committed bytes are at or above heap_soft_limit; used to make the
+    // HeapSoftLimitExceeded event fire only on the upward crossing.
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED VOLATILE(int32_t) heap_soft_limit_state;
+
     // Used both in a GC and on the allocator code paths when heap_hard_limit is non zero
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY CLRCriticalSection check_commit_cs;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY CLRCriticalSection decommit_lock;
 
+#ifdef USE_REGIONS
+    // Set in gc_heap::init_decommit_thread if GCConfig::GetDecommitThread() is on
+    // and the dedicated decommit thread could be created.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool decommit_thread_running_p;
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY GCEvent decommit_thread_wake_event;
+#endif //USE_REGIONS
+
+#if !defined(MULTIPLE_HEAPS) && !defined(FEATURE_NATIVEAOT)
+    // Workstation GC has no heap to NUMA node affinity, so instead we remember
+    // each processor's node and bind allocation path commits to the node of the
+    // requesting thread. Entries are NUMA_NODE_UNDEFINED when NUMA is off.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY uint16_t proc_no_to_numa_node[MAX_SUPPORTED_CPUS];
+#endif //!MULTIPLE_HEAPS && !FEATURE_NATIVEAOT
+
     // Indicate to use large pages. This only works if hardlimit is also enabled.
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool use_large_pages_p;
 
@@ -4412,6 +4621,8 @@ private:
 #ifdef USE_REGIONS
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t regions_range;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool enable_special_regions_p;
+    // Per GC budget of gen2 regions a compacting GC may relocate, 0 means no limit.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY int incremental_compact_maxgen_regions;
 #else //USE_REGIONS
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t eph_gen_starts_size;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t min_segment_size;
@@ -4723,6 +4934,7 @@ public:
     void LeaveFinalizeLock();
     bool RegisterForFinalization (int gen, Object* obj, size_t size=0);
     Object* GetNextFinalizableObject (BOOL only_non_critical=FALSE);
+    size_t GetNextFinalizableObjects (Object** objs, size_t count, BOOL only_non_critical=FALSE);
     BOOL ScanForFinalization (promote_func* fn, int gen, gc_heap* hp);
     void RelocateFinalizationData (int gen, gc_heap* hp);
     void WalkFReachableObjects (fq_walk_fn fn);
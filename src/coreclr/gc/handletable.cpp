@@ -245,6 +245,154 @@ uint32_t HndGetHandleTableIndex(HHANDLETABLE hTable)
 }
 
 #ifndef DACCESS_COMPILE
+/*
+ * Thread-local handle cache
+ *
+ * A small per-thread block of preallocated handles layered above the shared
+ * per-table caches.  Creating and destroying handles of the heavily churned
+ * types (weak and strong) is satisfied from this block in the common case,
+ * so the fast path touches no shared cache lines.  The block is refilled
+ * from and spilled back to the shared caches in batches.
+ *
+ * Only the types up to HNDTYPE_STRONG are cached; the other types either
+ * carry extra scanning semantics (pinned, variable, ref counted, dependent)
+ * or are too rare to be worth a per-thread reserve.
+ *
+ */
+
+#define LOCAL_HANDLE_CACHE_TYPE_COUNT (HNDTYPE_STRONG + 1)
+#define LOCAL_HANDLE_CACHE_DEPTH      (8)
+#define LOCAL_HANDLE_CACHE_REFILL     (LOCAL_HANDLE_CACHE_DEPTH / 2)
+
+struct LocalHandleCache
+{
+    // the table the cached handles were carved out of - the cache follows
+    // whichever table the thread used last, which in practice doesn't change
+    HandleTable  *pTable;
+
+    // per-type count of cached handles
+    uint32_t      rguCount[LOCAL_HANDLE_CACHE_TYPE_COUNT];
+
+    // the cached handles - already typed, with a cleared referent, exactly
+    // as the shared caches store them
+    OBJECTHANDLE  rgHandles[LOCAL_HANDLE_CACHE_TYPE_COUNT][LOCAL_HANDLE_CACHE_DEPTH];
+
+    void Flush()
+    {
+        for (uint32_t uType = 0; uType < LOCAL_HANDLE_CACHE_TYPE_COUNT; uType++)
+        {
+            if (rguCount[uType])
+            {
+                TableFreeHandlesToCache(pTable, uType, rgHandles[uType], rguCount[uType]);
+                rguCount[uType] = 0;
+            }
+        }
+    }
+
+    ~LocalHandleCache()
+    {
+        // return any cached handles when the thread goes away - the handle
+        // tables themselves outlive the threads that use them
+        if (pTable)
+            Flush();
+    }
+};
+
+thread_local LocalHandleCache t_LocalHandleCache;
+
+
+/*
+ * LocalCacheAllocHandle
+ *
+ * Gets a handle of the specified type from the thread's local cache,
+ * refilling the cache from the shared caches on a miss.
+ *
+ */
+OBJECTHANDLE LocalCacheAllocHandle(HandleTable *pTable, uint32_t uType)
+{
+    WRAPPER_NO_CONTRACT;
+
+    _ASSERTE(uType < LOCAL_HANDLE_CACHE_TYPE_COUNT);
+
+    LocalHandleCache *pLocalCache = &t_LocalHandleCache;
+
+    // switching tables is rare - just spill the old table's handles
+    if (pLocalCache->pTable != pTable)
+    {
+        if (pLocalCache->pTable)
+            pLocalCache->Flush();
+
+        pLocalCache->pTable = pTable;
+    }
+
+    uint32_t uCount = pLocalCache->rguCount[uType];
+    if (uCount == 0)
+    {
+        // miss - refill the block in one batch, keeping the extra handles
+        // for subsequent requests
+        uCount = TableAllocHandlesFromCache(pTable, uType, pLocalCache->rgHandles[uType], LOCAL_HANDLE_CACHE_REFILL);
+
+        // did the table run out of handles?
+        if (uCount == 0)
+            return NULL;
+    }
+
+    // pop the topmost cached handle
+    uCount--;
+    pLocalCache->rguCount[uType] = uCount;
+
+    OBJECTHANDLE handle = pLocalCache->rgHandles[uType][uCount];
+    pLocalCache->rgHandles[uType][uCount] = NULL;
+
+    // sanity
+    _ASSERTE(handle);
+
+    return handle;
+}
+
+
+/*
+ * LocalCacheFreeHandle
+ *
+ * Tries to return a handle of the specified type to the thread's local
+ * cache.  Returns false if the cache has no room (or belongs to another
+ * table), in which case the caller frees the handle to the shared caches.
+ *
+ */
+bool LocalCacheFreeHandle(HandleTable *pTable, uint32_t uType, OBJECTHANDLE handle)
+{
+    WRAPPER_NO_CONTRACT;
+
+    _ASSERTE(uType < LOCAL_HANDLE_CACHE_TYPE_COUNT);
+
+    LocalHandleCache *pLocalCache = &t_LocalHandleCache;
+
+    // let the shared caches take handles from other tables
+    if (pLocalCache->pTable != pTable)
+        return false;
+
+    uint32_t uCount = pLocalCache->rguCount[uType];
+    if (uCount == LOCAL_HANDLE_CACHE_DEPTH)
+        return false;
+
+#ifdef DEBUG_DestroyedHandleValue
+    *(_UNCHECKED_OBJECTREF *)handle = DEBUG_DestroyedHandleValue;
+#else
+    // zero the handle's object pointer
+    *(_UNCHECKED_OBJECTREF *)handle = NULL;
+#endif
+
+    // if this handle type has user data then clear it - AFTER the referent is cleared!
+    if (TypeHasUserData(pTable, uType))
+        HandleQuickSetUserData(handle, 0L);
+
+    pLocalCache->rgHandles[uType][uCount] = handle;
+    pLocalCache->rguCount[uType] = uCount + 1;
+
+    return true;
+}
+
+
 /*
  * HndCreateHandle
  *
@@ -280,8 +428,11 @@ OBJECTHANDLE HndCreateHandle(HHANDLETABLE hTable, uint32_t uType, OBJECTREF obje
     // sanity check the type index
     _ASSERTE(uType < pTable->uTypeCount);
 
-    // get a handle from the table's cache
-    OBJECTHANDLE handle = TableAllocSingleHandleFromCache(pTable, uType);
+    // get a handle from the thread's local cache, or from the table's cache
+    // for types the local cache doesn't cover
+    OBJECTHANDLE handle = (uType < LOCAL_HANDLE_CACHE_TYPE_COUNT) ?
+        LocalCacheAllocHandle(pTable, uType) :
+        TableAllocSingleHandleFromCache(pTable, uType);
 
     // did the allocation succeed?
     if (!handle)
@@ -316,6 +467,66 @@ OBJECTHANDLE HndCreateHandle(HHANDLETABLE hTable, uint32_t uType, OBJECTREF obje
     // return the result
     return handle;
 }
+
+
+/*
+ * HndCreateHandles
+ *
+ * Entrypoint for allocating a batch of handles of the same type. Equivalent to
+ * calling HndCreateHandle once per object, but fetches all the handles from the
+ * table's cache in one pass so the cache synchronization is amortized across
+ * the batch. Returns the number of handles created, which may be less than
+ * uCount if the table runs out of memory; pHandles is filled in order with no
+ * gaps. Extra-info handle types are not supported.
+ *
+ */
+uint32_t HndCreateHandles(HHANDLETABLE hTable, uint32_t uType, OBJECTREF *pObjects, OBJECTHANDLE *pHandles, uint32_t uCount)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    // fetch the handle table pointer
+    HandleTable *pTable = Table(hTable);
+
+    // sanity check the type index - extra info would need to be set per handle
+    // BEFORE the referent, so types that carry it must go through HndCreateHandle
+    _ASSERTE(uType < pTable->uTypeCount);
+    _ASSERTE(!TypeHasUserData(pTable, uType));
+
+    // grab as many handles as we can from the table's cache in one pass
+    uint32_t uSatisfied = TableAllocHandlesFromCache(pTable, uType, pHandles, uCount);
+
+    for (uint32_t u = 0; u < uSatisfied; u++)
+    {
+        OBJECTHANDLE handle = pHandles[u];
+
+#ifdef DEBUG_DestroyedHandleValue
+        if (*(_UNCHECKED_OBJECTREF *)handle == DEBUG_DestroyedHandleValue)
+            *(_UNCHECKED_OBJECTREF *)handle = NULL;
+#endif
+
+        // the handle better not point at anything yet
+        _ASSERTE(*(_UNCHECKED_OBJECTREF *)handle == NULL);
+
+        VALIDATEOBJECTREF(pObjects[u]);
+
+        // store the reference
+        HndAssignHandle(handle, pObjects[u]);
+        STRESS_LOG2(LF_GC, LL_INFO1000, "CreateHandle: %p, type=%d\n", handle, uType);
+    }
+
+#if defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+    g_dwHandles += uSatisfied;
+#endif // defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+
+    // return how many handles we were able to create
+    return uSatisfied;
+}
 #endif // !DACCESS_COMPILE
 
 #ifdef _DEBUG
@@ -379,8 +590,10 @@ void HndDestroyHandle(HHANDLETABLE hTable, uint32_t uType, OBJECTHANDLE handle)
 
     _ASSERTE(HandleFetchType(handle) == uType);
 
-    // return the handle to the table's cache
-    TableFreeSingleHandleToCache(pTable, uType, handle);
+    // return the handle to the thread's local cache if it has room,
+    // otherwise to the table's cache
+    if ((uType >= LOCAL_HANDLE_CACHE_TYPE_COUNT) || !LocalCacheFreeHandle(pTable, uType, handle))
+        TableFreeSingleHandleToCache(pTable, uType, handle);
 
 #if defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
     g_dwHandles--;
@@ -418,6 +631,55 @@ void HndDestroyHandleOfUnknownType(HHANDLETABLE hTable, OBJECTHANDLE handle)
     HndDestroyHandle(hTable, HandleFetchType(handle), handle);
 }
 
+
+/*
+ * HndDestroyHandles
+ *
+ * Entrypoint for freeing a batch of handles of the same type from the same
+ * table. Equivalent to calling HndDestroyHandle once per handle, but returns
+ * all the handles to the table's cache in one pass so the cache
+ * synchronization is amortized across the batch.
+ *
+ */
+void HndDestroyHandles(HHANDLETABLE hTable, uint32_t uType, const OBJECTHANDLE *pHandles, uint32_t uCount)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;     // because of TableFreeHandlesToCache
+    }
+    CONTRACTL_END;
+
+    // fetch the handle table pointer
+    HandleTable *pTable = Table(hTable);
+
+    // sanity check the type index
+    _ASSERTE(uType < pTable->uTypeCount);
+
+    for (uint32_t u = 0; u < uCount; u++)
+    {
+        OBJECTHANDLE handle = pHandles[u];
+
+        // sanity check the handle we are being asked to free
+        _ASSERTE(handle);
+        _ASSERTE(HandleFetchType(handle) == uType);
+
+        STRESS_LOG2(LF_GC, LL_INFO1000, "DestroyHandle: *%p->%p\n", handle, *(_UNCHECKED_OBJECTREF *)handle);
+
+        FIRE_EVENT(DestroyGCHandle, (void *)handle);
+        FIRE_EVENT(PrvDestroyGCHandle, (void *)handle);
+    }
+
+    // return the whole batch to the table's cache in one pass
+    TableFreeHandlesToCache(pTable, uType, pHandles, uCount);
+
+#if defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+    g_dwHandles -= uCount;
+#endif // defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+}
+
 /*
  * HndSetHandleExtraInfo
  *
@@ -69,6 +69,12 @@ uint32_t        HndGetHandleTableIndex(HHANDLETABLE hTable);
 OBJECTHANDLE    HndCreateHandle(HHANDLETABLE hTable, uint32_t uType, OBJECTREF object, uintptr_t lExtraInfo = 0);
 void            HndDestroyHandle(HHANDLETABLE hTable, uint32_t uType, OBJECTHANDLE handle);
 
+/*
+ * batched handle allocation and deallocation
+ */
+uint32_t        HndCreateHandles(HHANDLETABLE hTable, uint32_t uType, OBJECTREF *pObjects, OBJECTHANDLE *pHandles, uint32_t uCount);
+void            HndDestroyHandles(HHANDLETABLE hTable, uint32_t uType, const OBJECTHANDLE *pHandles, uint32_t uCount);
+
 void            HndDestroyHandleOfUnknownType(HHANDLETABLE hTable, OBJECTHANDLE handle);
 
 /*
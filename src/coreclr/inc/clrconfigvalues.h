@@ -129,6 +129,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_JitPitchMaxVal, W("JitPitchMaxVal"), (DWORD)0x
 /// Assembly Loader
 ///
 CONFIG_DWORD_INFO(INTERNAL_GetAssemblyIfLoadedIgnoreRidMap, W("GetAssemblyIfLoadedIgnoreRidMap"), 0, "Used to force loader to ignore assemblies cached in the rid-map")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_EagerStringLiterals, W("EagerStringLiterals"), 0, "Eagerly interns all of a module's string literals in one frozen object heap batch when the module is loaded")
 
 ///
 /// PE Loader
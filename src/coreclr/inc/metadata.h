@@ -834,6 +834,20 @@ DECLARE_INTERFACE_(IMDInternalImport, IUnknown)
         BOOL    *pbIs80Plus,            // [OUT] specifies where there are extended characters >= 0x80.
         LPCWSTR *pwszUserString) PURE;
 
+    //****************************************
+    // Walk the user string heap: get the string at heap index nIndex (pass 0 to
+    // start) and the index of the next string in the heap. Returns S_FALSE once
+    // nIndex is past the last string. Empty strings are returned with a count
+    // of 0 and a NULL string pointer, like GetUserString.
+    //****************************************
+    __checkReturn
+    STDMETHOD(GetUserStringAndNextIndex)(
+        ULONG    nIndex,                // [IN] heap index of the string.
+        ULONG   *pchString,             // [OUT] count of characters in the string.
+        BOOL    *pbIs80Plus,            // [OUT] specifies where there are extended characters >= 0x80.
+        LPCWSTR *pwszUserString,        // [OUT] the string, NULL if empty.
+        ULONG   *pnNextIndex) PURE;     // [OUT] heap index of the next string.
+
     //*****************************************************************************
     // p-invoke APIs.
     //*****************************************************************************
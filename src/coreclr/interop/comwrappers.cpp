@@ -568,6 +568,7 @@ ManagedObjectWrapper::ManagedObjectWrapper(
     , _userDefined{ userDefined }
     , _dispatches{ dispatches }
     , _flags{ flags }
+    , _lastDispatchIndex{ -1 }
 {
     bool wasSet = TrySetObjectHandle(objectHandle);
     _ASSERTE(wasSet);
@@ -582,10 +583,18 @@ ManagedObjectWrapper::~ManagedObjectWrapper()
 
 void* ManagedObjectWrapper::AsRuntimeDefined(_In_ REFIID riid)
 {
+    // Check the most recently resolved entry before scanning.
+    int32_t hint = _lastDispatchIndex;
+    if (hint >= 0 && hint < _runtimeDefinedCount && IsEqualGUID(_runtimeDefined[hint].IID, riid))
+    {
+        return ABI::IndexIntoDispatchSection(hint, _dispatches);
+    }
+
     for (int32_t i = 0; i < _runtimeDefinedCount; ++i)
     {
         if (IsEqualGUID(_runtimeDefined[i].IID, riid))
         {
+            _lastDispatchIndex = i;
             return ABI::IndexIntoDispatchSection(i, _dispatches);
         }
     }
@@ -595,10 +604,19 @@ void* ManagedObjectWrapper::AsRuntimeDefined(_In_ REFIID riid)
 
 void* ManagedObjectWrapper::AsUserDefined(_In_ REFIID riid)
 {
+    // Check the most recently resolved entry before scanning.
+    int32_t hint = _lastDispatchIndex;
+    if (hint >= _runtimeDefinedCount && hint < _runtimeDefinedCount + _userDefinedCount
+        && IsEqualGUID(_userDefined[hint - _runtimeDefinedCount].IID, riid))
+    {
+        return ABI::IndexIntoDispatchSection(hint, _dispatches);
+    }
+
     for (int32_t i = 0; i < _userDefinedCount; ++i)
     {
         if (IsEqualGUID(_userDefined[i].IID, riid))
         {
+            _lastDispatchIndex = i + _runtimeDefinedCount;
             return ABI::IndexIntoDispatchSection(i + _runtimeDefinedCount, _dispatches);
         }
     }
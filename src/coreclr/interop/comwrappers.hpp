@@ -65,6 +65,13 @@ private:
 
     Volatile<CreateComInterfaceFlagsEx> _flags;
 
+    // Index into the dispatch section of the most recently resolved interface,
+    // or -1 if nothing has been resolved yet. Interface resolution on a wrapper
+    // tends to repeat the same IID, so this hint lets the query avoid the linear
+    // IID scan. Access is racy by design - the tables it indexes are immutable,
+    // so a stale or torn value is validated and simply falls back to the scan.
+    Volatile<int32_t> _lastDispatchIndex;
+
 public: // static
     // Get the implementation for IUnknown.
     static void GetIUnknownImpl(
@@ -38,6 +38,110 @@ size_t ArenaAllocator::getDefaultPageSize()
     return DEFAULT_PAGE_SIZE;
 }
 
+ArenaAllocator::PageDescriptor* volatile ArenaAllocator::s_pagePool      = nullptr;
+volatile LONG                            ArenaAllocator::s_pagePoolCount = 0;
+
+//------------------------------------------------------------------------
+// ArenaAllocator::tryAcquirePooledPage:
+//    Attempts to take a default-size page from the shared page pool.
+//
+// Return Value:
+//    A page descriptor, or `nullptr` if the pool is empty.
+//
+// Notes:
+//    To avoid the ABA problem of a lock-free stack pop, this takes the
+//    entire pool with a single exchange, keeps the first page, and pushes
+//    the remainder back. The remainder is bounded by MAX_POOLED_PAGES, so
+//    the walk to find its tail is short.
+ArenaAllocator::PageDescriptor* ArenaAllocator::tryAcquirePooledPage()
+{
+    if (s_pagePool == nullptr)
+    {
+        return nullptr;
+    }
+
+    PageDescriptor* page = InterlockedExchangeT(&s_pagePool, static_cast<PageDescriptor*>(nullptr));
+    if (page == nullptr)
+    {
+        return nullptr;
+    }
+
+    PageDescriptor* remainder = page->m_next;
+    if (remainder != nullptr)
+    {
+        PageDescriptor* tail = remainder;
+        while (tail->m_next != nullptr)
+        {
+            tail = tail->m_next;
+        }
+
+        PageDescriptor* head;
+        do
+        {
+            head           = s_pagePool;
+            tail->m_next   = head;
+        } while (InterlockedCompareExchangeT(&s_pagePool, remainder, head) != head);
+    }
+
+    InterlockedDecrement(&s_pagePoolCount);
+    return page;
+}
+
+//------------------------------------------------------------------------
+// ArenaAllocator::tryReturnPageToPool:
+//    Attempts to put a page on the shared page pool instead of freeing it.
+//
+// Arguments:
+//    page - The page to return to the pool.
+//
+// Return Value:
+//    True if the page was pooled; false if the caller must free it.
+//
+// Notes:
+//    Only default-size host pages are pooled; oversized pages (from large
+//    single allocations) would bloat the pool's footprint for little reuse.
+//    The count check and increment are not atomic with respect to each
+//    other, so the pool may briefly exceed MAX_POOLED_PAGES by the number
+//    of racing threads; the bound is a footprint target, not an invariant.
+bool ArenaAllocator::tryReturnPageToPool(PageDescriptor* page)
+{
+    if (bypassHostAllocator() || (page->m_pageBytes != DEFAULT_PAGE_SIZE))
+    {
+        return false;
+    }
+
+    if (s_pagePoolCount >= MAX_POOLED_PAGES)
+    {
+        return false;
+    }
+
+    InterlockedIncrement(&s_pagePoolCount);
+
+    PageDescriptor* head;
+    do
+    {
+        head         = s_pagePool;
+        page->m_next = head;
+    } while (InterlockedCompareExchangeT(&s_pagePool, page, head) != head);
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// ArenaAllocator::shutdown:
+//    Frees any pages held by the shared page pool.
+void ArenaAllocator::shutdown()
+{
+    PageDescriptor* page = InterlockedExchangeT(&s_pagePool, static_cast<PageDescriptor*>(nullptr));
+
+    for (PageDescriptor* next; page != nullptr; page = next)
+    {
+        next = page->m_next;
+        freeHostMemory(page, page->m_pageBytes);
+        InterlockedDecrement(&s_pagePoolCount);
+    }
+}
+
 //------------------------------------------------------------------------
 // ArenaAllocator::ArenaAllocator:
 //    Default-constructs an arena allocator.
@@ -80,14 +184,25 @@ void* ArenaAllocator::allocateNewPage(size_t size)
         m_lastPage->m_usedBytes = m_nextFreeByte - m_lastPage->m_contents;
     }
 
+    PageDescriptor* newPage = nullptr;
     if (!bypassHostAllocator())
     {
         // Round to the nearest multiple of default page size
         pageSize = roundUp(pageSize, DEFAULT_PAGE_SIZE);
+
+        // Default-size pages are by far the common case and are the ones the
+        // shared pool recycles.
+        if (pageSize == DEFAULT_PAGE_SIZE)
+        {
+            newPage = tryAcquirePooledPage();
+        }
     }
 
-    // Allocate the new page
-    PageDescriptor* newPage = static_cast<PageDescriptor*>(allocateHostMemory(pageSize, &pageSize));
+    if (newPage == nullptr)
+    {
+        // Allocate the new page
+        newPage = static_cast<PageDescriptor*>(allocateHostMemory(pageSize, &pageSize));
+    }
 
     // Append the new page to the end of the list
     newPage->m_next      = nullptr;
@@ -122,11 +237,14 @@ void ArenaAllocator::destroy()
 {
     PageDescriptor* page = m_firstPage;
 
-    // Free all of the allocated pages
+    // Return the allocated pages to the shared pool when possible, and free the rest
     for (PageDescriptor* next; page != nullptr; page = next)
     {
         next = page->m_next;
-        freeHostMemory(page, page->m_pageBytes);
+        if (!tryReturnPageToPool(page))
+        {
+            freeHostMemory(page, page->m_pageBytes);
+        }
     }
 
     // Clear out the allocator's fields
@@ -40,6 +40,9 @@ private:
     enum
     {
         DEFAULT_PAGE_SIZE = 0x10000,
+
+        // Maximum number of pages retained in the shared page pool.
+        MAX_POOLED_PAGES = 32,
     };
 
     PageDescriptor* m_firstPage;
@@ -49,8 +52,18 @@ private:
     BYTE* m_nextFreeByte;
     BYTE* m_lastFreeByte;
 
+    // A small process-wide pool of default-size pages recycled across compilations,
+    // so that back-to-back compilations reuse warm pages instead of asking the host
+    // for fresh ones. The pool is a lock-free stack; the count is approximate and
+    // only bounds the pool's footprint.
+    static PageDescriptor* volatile s_pagePool;
+    static volatile LONG            s_pagePoolCount;
+
     void* allocateNewPage(size_t size);
 
+    static PageDescriptor* tryAcquirePooledPage();
+    static bool tryReturnPageToPool(PageDescriptor* page);
+
     static void* allocateHostMemory(size_t size, size_t* pActualSize);
     static void freeHostMemory(void* block, size_t size);
 
@@ -143,6 +156,8 @@ public:
 
     void destroy();
 
+    static void shutdown();
+
     inline void* allocateMemory(size_t sz);
 
     size_t getTotalBytesAllocated();
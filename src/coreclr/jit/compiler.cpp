@@ -5048,9 +5048,14 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
         // Optimize block order
         //
         DoPhase(this, PHASE_OPTIMIZE_LAYOUT, &Compiler::optOptimizeLayout);
+    }
 
-        // Conditional to Switch conversion
-        //
+    // Conditional to Switch conversion. Also run this at tier-0: it needs no optimization
+    // analysis, and dispatch-style methods spend their warmup executing tier-0 code where
+    // the compare chains are hottest. Skip it for debuggable code, which must keep the
+    // flow graph close to the IL.
+    if (opts.OptimizationEnabled() || (opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0) && !opts.compDbgCode))
+    {
         DoPhase(this, PHASE_SWITCH_RECOGNITION, &Compiler::optSwitchRecognition);
     }
 
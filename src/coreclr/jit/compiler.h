@@ -7469,9 +7469,15 @@ public:
                 return 3;
             }
 
-            // We plan to use 3 for CoreCLR too, but we need to make sure it doesn't regress performance
-            // as CoreCLR heavily relies on Dynamic PGO while for NativeAOT we *usually* don't have it and
-            // can only perform the "exact" devirtualization.
+            // For CoreCLR, build guard chains only when we have fresh dynamic profile data
+            // to order the guesses by observed frequency; candidate selection then applies
+            // its own per-guess likelihood thresholds. With static or stale profiles the
+            // histogram ordering is not reliable enough to pay for the extra type checks.
+            if ((fgPgoSource == ICorJitInfo::PgoSource::Dynamic) && !opts.jitFlags->IsSet(JitFlags::JIT_FLAG_SIZE_OPT))
+            {
+                return 3;
+            }
+
             return 1;
         }
 
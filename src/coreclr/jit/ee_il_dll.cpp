@@ -161,6 +161,11 @@ void jitShutdown(bool processIsTerminating)
 
     Compiler::compShutdown();
 
+    if (!processIsTerminating)
+    {
+        ArenaAllocator::shutdown();
+    }
+
     FILE* file = s_jitstdout;
     if ((file != nullptr) && (file != procstdout()))
     {
@@ -4830,6 +4830,11 @@ void emitter::emitJumpDistBind()
 
     int jmp_iteration = 1;
 
+    // The first jump that a later iteration might still shorten. Everything in front
+    // of it has reached its final size, so re-iterations can start here instead of
+    // re-walking the whole jump list (and the groups that precede it).
+    instrDescJmp* jmpFirst = emitJumpList;
+
 /*****************************************************************************/
 /* If we iterate to look for more jumps to shorten, we start again here.     */
 /*****************************************************************************/
@@ -4855,11 +4860,13 @@ AGAIN:
     adjIG         = 0;
     minShortExtra = (UNATIVE_OFFSET)-1;
 
+    instrDescJmp* firstLongJmp = nullptr; // first jump this pass that may yet be shortened
+
 #if defined(TARGET_ARM)
     minMediumExtra = (UNATIVE_OFFSET)-1;
 #endif // TARGET_ARM
 
-    for (jmp = emitJumpList; jmp; jmp = jmp->idjNext)
+    for (jmp = jmpFirst; jmp; jmp = jmp->idjNext)
     {
         insGroup* jmpIG;
         insGroup* tgtIG;
@@ -5006,9 +5013,9 @@ AGAIN:
 
         if (lstIG != jmpIG)
         {
-            /* Were there any jumps before this one? */
+            /* Were there any jumps before this one that shrunk anything? */
 
-            if (lstIG)
+            if (lstIG && (adjIG != 0))
             {
                 /* Adjust the offsets of the intervening blocks */
 
@@ -5079,7 +5086,12 @@ AGAIN:
                 goto SHORT_JMP;
             }
 
-            // Keep the large form.
+            // Keep the large form; the total code size may still shrink enough
+            // for a later iteration to shorten this access.
+            if (firstLongJmp == nullptr)
+            {
+                firstLongJmp = jmp;
+            }
             continue;
         }
 #endif
@@ -5385,6 +5397,11 @@ AGAIN:
          * Go try the next one.
          */
 
+        if (firstLongJmp == nullptr)
+        {
+            firstLongJmp = jmp;
+        }
+
         continue;
 
     /*****************************************************************************/
@@ -5481,8 +5498,19 @@ AGAIN:
 
         jmpIG->igFlags |= IGF_UPD_ISZ;
 
+        /* A medium-sized jump (ARM) may still become short in a later iteration */
+
+        if (!jmp->idjShort && (firstLongJmp == nullptr))
+        {
+            firstLongJmp = jmp;
+        }
+
     } // end for each jump
 
+    /* The next iteration need not revisit jumps that have reached their final size */
+
+    jmpFirst = firstLongJmp;
+
     /* Did we shorten any jumps? */
 
     if (adjIG)
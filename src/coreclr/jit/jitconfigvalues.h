@@ -474,6 +474,15 @@ CONFIG_INTEGER(JitDoIfConversion, W("JitDoIfConversion"), 1) // Perform If conve
 // Max # of MapSelect's considered for a particular top-level invocation.
 CONFIG_INTEGER(JitVNMapSelBudget, W("JitVNMapSelBudget"), DEFAULT_MAP_SELECT_BUDGET)
 
+CONFIG_INTEGER(JitLsraHotnessWeightedSpill, W("JitLsraHotnessWeightedSpill"), 0) // If set, cap tracked-local spill
+                                                                                 // weights by the block weights of the
+                                                                                 // spill site and the next use when
+                                                                                 // profile data is available.
+
+CONFIG_INTEGER(JitCsePressureEstimate, W("JitCsePressureEstimate"), 0) // If set, charge stack store/load costs to
+                                                                       // non-aggressive CSE candidates when the
+                                                                       // register file is oversubscribed.
+
 CONFIG_INTEGER(TailCallLoopOpt, W("TailCallLoopOpt"), 1) // Convert recursive tail calls to loops
 CONFIG_METHODSET(AltJit, W("AltJit"))         // Enables AltJit and selectively limits it to the specified methods.
 CONFIG_METHODSET(AltJitNgen, W("AltJitNgen")) // Enables AltJit for NGEN and selectively limits it
@@ -25,7 +25,14 @@ void ArrIndex::Print(unsigned dim /* = -1 */)
     printf("V%02d", arrLcl);
     for (unsigned i = 0; i < ((dim == (unsigned)-1) ? rank : dim); ++i)
     {
-        printf("[V%02d]", indLcls.Get(i));
+        if (indOffs.Get(i) != 0)
+        {
+            printf("[V%02d+%d]", indLcls.Get(i), indOffs.Get(i));
+        }
+        else
+        {
+            printf("[V%02d]", indLcls.Get(i));
+        }
     }
 }
 
@@ -187,6 +194,10 @@ GenTree* LC_Expr::ToGenTree(Compiler* comp, BasicBlock* bb)
     {
         case Ident:
             return ident.ToGenTree(comp, bb);
+        case IdentPlusConst:
+            // The caller is responsible for emitting a condition that proves
+            // "ident + constant" does not overflow (see DeriveLoopCloningConditions).
+            return comp->gtNewOperNode(GT_ADD, TYP_INT, ident.ToGenTree(comp, bb), comp->gtNewIconNode(constant));
         default:
             assert(!"Could not convert LC_Expr to GenTree");
             unreached();
@@ -1277,6 +1288,17 @@ bool Compiler::optDeriveLoopCloningConditions(unsigned loopNum, LoopCloneContext
             JITDUMP("> ArrLen not matching\n");
             return false;
         }
+
+        // The deref and condition trees are built from the bare index locals, so a
+        // limit like "a[i + k].Length" is not supported.
+        for (unsigned i = 0; i < index->rank; i++)
+        {
+            if (index->indOffs[i] != 0)
+            {
+                JITDUMP("> ArrLen limit uses an index with a constant offset\n");
+                return false;
+            }
+        }
         ident = LC_Ident::CreateArrAccess(LC_Array(LC_Array::Jagged, index, LC_Array::ArrLen));
 
         // Ensure that this array must be dereference-able, before executing the actual condition.
@@ -1319,9 +1341,23 @@ bool Compiler::optDeriveLoopCloningConditions(unsigned loopNum, LoopCloneContext
             case LcOptInfo::LcJaggedArray:
             {
                 LcJaggedArrayOptInfo* arrIndexInfo = optInfo->AsLcJaggedArrayOptInfo();
-                LC_Array     arrLen(LC_Array::Jagged, &arrIndexInfo->arrIndex, arrIndexInfo->dim, LC_Array::ArrLen);
-                LC_Ident     arrLenIdent = LC_Ident::CreateArrAccess(arrLen);
-                LC_Condition cond(opLimitCondition, LC_Expr(ident), LC_Expr(arrLenIdent));
+                LC_Array arrLen(LC_Array::Jagged, &arrIndexInfo->arrIndex, arrIndexInfo->dim, LC_Array::ArrLen);
+                LC_Ident arrLenIdent = LC_Ident::CreateArrAccess(arrLen);
+
+                // If the access uses "iterVar + positiveConst" as the index, test the limit
+                // shifted by that constant against the length, and guard the shift itself
+                // against overflowing an int (the guard fails to the slow path).
+                LC_Expr   limitExpr(ident);
+                const int indexOffs = arrIndexInfo->arrIndex.indOffs[arrIndexInfo->dim];
+                if (indexOffs != 0)
+                {
+                    LC_Condition noOverflow(GT_LE, LC_Expr(ident),
+                                            LC_Expr(LC_Ident::CreateConst((unsigned)(INT32_MAX - indexOffs))));
+                    context->EnsureConditions(loopNum)->Push(noOverflow);
+                    limitExpr = LC_Expr(ident, indexOffs);
+                }
+
+                LC_Condition cond(opLimitCondition, limitExpr, LC_Expr(arrLenIdent));
                 context->EnsureConditions(loopNum)->Push(cond);
 
                 // Ensure that this array must be dereference-able, before executing the actual condition.
@@ -2389,7 +2425,25 @@ bool Compiler::optExtractArrIndex(GenTree* tree, ArrIndex* result, unsigned lhsN
         return false;
     }
     GenTreeBoundsChk* arrBndsChk = before->AsBoundsChk();
-    if (arrBndsChk->GetIndex()->gtOper != GT_LCL_VAR)
+
+    // The index is either a local, or a local plus a positive constant ("a[i + 2]");
+    // for the latter the cloning conditions test the shifted limit against the length.
+    // Negative offsets would additionally need a shifted lower bound test, so we don't
+    // accept them here.
+    GenTree* indexTree = arrBndsChk->GetIndex();
+    int      indexOffs = 0;
+    if (indexTree->OperIs(GT_ADD) && indexTree->gtGetOp1()->OperIs(GT_LCL_VAR) &&
+        indexTree->gtGetOp2()->IsCnsIntOrI())
+    {
+        ssize_t offset = indexTree->gtGetOp2()->AsIntCon()->IconValue();
+        if ((offset <= 0) || (offset >= INT32_MAX))
+        {
+            return false;
+        }
+        indexOffs = (int)offset;
+        indexTree = indexTree->gtGetOp1();
+    }
+    if (indexTree->gtOper != GT_LCL_VAR)
     {
         return false;
     }
@@ -2410,13 +2464,14 @@ bool Compiler::optExtractArrIndex(GenTree* tree, ArrIndex* result, unsigned lhsN
         return false;
     }
 
-    unsigned indLcl = arrBndsChk->GetIndex()->AsLclVarCommon()->GetLclNum();
+    unsigned indLcl = indexTree->AsLclVarCommon()->GetLclNum();
 
     if (lhsNum == BAD_VAR_NUM)
     {
         result->arrLcl = arrLcl;
     }
     result->indLcls.Push(indLcl);
+    result->indOffs.Push(indexOffs);
     result->bndsChks.Push(tree);
     result->useBlock = compCurBB;
     result->rank++;
@@ -2669,6 +2724,15 @@ Compiler::fgWalkResult Compiler::optCanOptimizeByLoopCloning(GenTree* tree, Loop
                         JITDUMP("V%02d is assigned in loop\n", arrIndex.indLcls[dim2]);
                         return WALK_SKIP_SUBTREES;
                     }
+
+                    // A constant index offset is only supported on the dimension being
+                    // optimized; the outer dimensions feed the deref condition trees,
+                    // which are built from the bare index locals.
+                    if (arrIndex.indOffs[dim2] != 0)
+                    {
+                        JITDUMP("V%02d has a constant offset on an outer dimension\n", arrIndex.indLcls[dim2]);
+                        return WALK_SKIP_SUBTREES;
+                    }
                 }
 #ifdef DEBUG
                 if (verbose)
@@ -203,11 +203,13 @@ struct ArrIndex
 {
     unsigned                      arrLcl;   // The array base local num
     JitExpandArrayStack<unsigned> indLcls;  // The indices local nums
+    JitExpandArrayStack<int>      indOffs;  // Constant offsets added to the index locals (0 for a plain index)
     JitExpandArrayStack<GenTree*> bndsChks; // The bounds checks nodes along each dimension.
     unsigned                      rank;     // Rank of the array
     BasicBlock*                   useBlock; // Block where the [] occurs
 
-    ArrIndex(CompAllocator alloc) : arrLcl(BAD_VAR_NUM), indLcls(alloc), bndsChks(alloc), rank(0), useBlock(nullptr)
+    ArrIndex(CompAllocator alloc)
+        : arrLcl(BAD_VAR_NUM), indLcls(alloc), indOffs(alloc), bndsChks(alloc), rank(0), useBlock(nullptr)
     {
     }
 
@@ -291,6 +293,7 @@ struct LcMdArrayOptInfo : public LcOptInfo
             for (unsigned i = 0; i < dim; ++i)
             {
                 index->indLcls.Push(arrElem->gtArrInds[i]->AsLclVarCommon()->GetLclNum());
+                index->indOffs.Push(0);
             }
             index->arrLcl = arrElem->gtArrObj->AsLclVarCommon()->GetLclNum();
         }
@@ -657,9 +660,11 @@ struct LC_Expr
     {
         Invalid,
         Ident,
+        IdentPlusConst,
     };
 
     LC_Ident ident;
+    int      constant; // Constant added to the ident (IdentPlusConst only)
     ExprType type;
 
     // Equality operator
@@ -673,6 +678,11 @@ struct LC_Expr
             return false;
         }
 
+        if ((type == IdentPlusConst) && (constant != that.constant))
+        {
+            return false;
+        }
+
         // Check if the ident match.
         return (ident == that.ident);
     }
@@ -684,6 +694,12 @@ struct LC_Expr
         {
             ident.Print();
         }
+        else if (type == IdentPlusConst)
+        {
+            printf("(");
+            ident.Print();
+            printf(" + %d)", constant);
+        }
         else
         {
             printf("INVALID");
@@ -691,10 +707,13 @@ struct LC_Expr
     }
 #endif
 
-    LC_Expr() : type(Invalid)
+    LC_Expr() : constant(0), type(Invalid)
+    {
+    }
+    explicit LC_Expr(const LC_Ident& ident) : ident(ident), constant(0), type(Ident)
     {
     }
-    explicit LC_Expr(const LC_Ident& ident) : ident(ident), type(Ident)
+    LC_Expr(const LC_Ident& ident, int constant) : ident(ident), constant(constant), type(IdentPlusConst)
     {
     }
 
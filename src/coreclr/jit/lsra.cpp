@@ -191,6 +191,19 @@ weight_t LinearScan::getWeight(RefPosition* refPos)
             // ref position.
             const LclVarDsc* varDsc = compiler->lvaGetDesc(treeNode->AsLclVarCommon());
             weight                  = varDsc->lvRefCntWtd();
+            if (hotnessWeightedSpill)
+            {
+                // The aggregate weighted ref count overstates the cost of spilling at a cold
+                // RefPosition: the only code added is the store here and the reload at the
+                // next use. Cap the weight by the hotness of those two sites so that live
+                // ranges prefer to split at cold-block boundaries.
+                weight_t splitWeight = blockInfo[refPos->bbNum].weight;
+                if (refPos->nextRefPosition != nullptr)
+                {
+                    splitWeight += blockInfo[refPos->nextRefPosition->bbNum].weight;
+                }
+                weight = min(weight, splitWeight);
+            }
             if (refPos->getInterval()->isSpilled)
             {
                 // Decrease the weight if the interval has already been spilled.
@@ -762,6 +775,11 @@ LinearScan::LinearScan(Compiler* theCompiler)
     // set won't be recomputed until after Lowering (and this constructor is called prior to Lowering),
     // so we don't want to check that yet.
     enregisterLocalVars = compiler->compEnregLocals();
+
+    // Hotness-weighted spill costing is only meaningful when block weights come from
+    // real profile data; the static weights are too coarse to distinguish hot and cold
+    // spill points.
+    hotnessWeightedSpill = (JitConfig.JitLsraHotnessWeightedSpill() != 0) && compiler->fgIsUsingProfileWeights();
 #ifdef TARGET_ARM64
     availableIntRegs = (RBM_ALLINT & ~(RBM_PR | RBM_FP | RBM_LR) & ~compiler->codeGen->regSet.rsMaskResvd);
 #elif defined(TARGET_LOONGARCH64) || defined(TARGET_RISCV64)
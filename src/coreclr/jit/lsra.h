@@ -1643,6 +1643,11 @@ private:
         return enregisterLocalVars;
     }
 
+    // True if spill weights for tracked locals are capped by the hotness of the blocks
+    // containing the spilling RefPosition and its next use. Only enabled when profile
+    // data is available; see LinearScan::getWeight.
+    bool hotnessWeightedSpill;
+
     // Ordered list of RefPositions
     RefPositionList refPositions;
 
@@ -2632,6 +2632,53 @@ public:
 #endif // FEATURE_SIMD
         }
 
+        // If the pressure estimate is enabled, check whether a new temp can plausibly be
+        // kept in a register at all. Mirroring the register file sizing that loop hoisting
+        // uses, count the registers that survive (or avoid) the candidate's calls and
+        // compare against the variables already competing for them. A non-aggressive
+        // candidate in an oversubscribed method is expected to end up with a stack home,
+        // so charge a store at each def and a load at each use; candidates whose only
+        // benefit was a cheap register re-use will then fail the savings check below.
+        //
+        if ((JitConfig.JitCsePressureEstimate() != 0) && canEnregister && !candidate->IsAggressive())
+        {
+            unsigned availRegCount;
+            if (varTypeUsesFloatReg(candidate->Expr()))
+            {
+                availRegCount = CNT_CALLEE_SAVED_FLOAT;
+                if (!candidate->LiveAcrossCall())
+                {
+                    availRegCount += CNT_CALLEE_TRASH_FLOAT - 1;
+                }
+#ifdef TARGET_ARM
+                // On ARM each double takes two FP registers.
+                availRegCount /= 2;
+#endif
+            }
+            else
+            {
+                availRegCount = CNT_CALLEE_SAVED - 1;
+                if (!candidate->LiveAcrossCall())
+                {
+                    availRegCount += CNT_CALLEE_TRASH - 1;
+                }
+            }
+
+            if ((enregCount + m_addCSEcount) >= (availRegCount * 2))
+            {
+#ifdef DEBUG
+                if (m_pCompiler->verbose)
+                {
+                    printf("CSE pressure estimate: %u locals and temps competing for %u registers, assuming a stack "
+                           "home\n",
+                           enregCount + m_addCSEcount, availRegCount);
+                }
+#endif
+                cse_def_cost += 2;
+                cse_use_cost += 2;
+            }
+        }
+
         // estimate the cost from lost codesize reduction if we do not perform the CSE
         if (candidate->Size() > cse_use_cost)
         {
@@ -3475,6 +3475,63 @@ MDInternalRW::GetUserString(    // Offset into the string blob heap.
     return S_OK;
 } // MDInternalRW::GetUserString
 
+//*****************************************************************************
+// Walk the user string heap: get the string at the given heap index and the
+// index of the next string. Returns S_FALSE past the last string.
+//*****************************************************************************
+__checkReturn
+HRESULT
+MDInternalRW::GetUserStringAndNextIndex(
+    ULONG    nIndex,                    // [IN] heap index of the string.
+    ULONG   *pcchStringSize,            // [OUT] count of characters in the string.
+    BOOL    *pfIs80Plus,                // [OUT] specifies where there are extended characters >= 0x80.
+    LPCWSTR *pwszUserString,            // [OUT] the string, NULL if empty.
+    ULONG   *pnNextIndex)               // [OUT] heap index of the next string.
+{
+    HRESULT hr;
+    LPWSTR  wszTmp;
+
+    // no need to lock this function.
+
+    if (pfIs80Plus != NULL)
+    {
+        *pfIs80Plus = FALSE;
+    }
+    *pwszUserString = NULL;
+    *pcchStringSize = 0;
+
+    _ASSERTE(pcchStringSize != NULL);
+    MetaData::DataBlob userString;
+    IfFailRet(m_pStgdb->m_MiniMd.GetUserStringAndNextIndex(nIndex, &userString, pnNextIndex));
+    if (hr == S_FALSE)
+    {   // Past the last user string in the heap.
+        return hr;
+    }
+
+    wszTmp = reinterpret_cast<LPWSTR>(userString.GetDataPointer());
+
+    *pcchStringSize = userString.GetSize() / sizeof(WCHAR);
+
+    if (userString.IsEmpty())
+    {
+        *pwszUserString = NULL;
+        return S_OK;
+    }
+
+    if (pfIs80Plus != NULL)
+    {
+        if (userString.GetSize() % sizeof(WCHAR) == 0)
+        {
+            *pfIs80Plus = TRUE; // no indicator, presume the worst
+        }
+        // Return the user string terminator (contains value fIs80Plus)
+        *pfIs80Plus = *(reinterpret_cast<PBYTE>(wszTmp + *pcchStringSize));
+    }
+
+    *pwszUserString = wszTmp;
+    return S_OK;
+} // MDInternalRW::GetUserStringAndNextIndex
+
 //*****************************************************************************
 // Get the properties for the given Assembly token.
 //*****************************************************************************
@@ -121,15 +121,29 @@ CMiniMdRW::GetDeltaRecord(
     }
 
     // Use the remap table to find the physical row containing this logical row.
-    iMap = (*m_rENCRecs)[ixTbl];
-    IfFailRet(GetENCMapRecord(iMap, &pMap));
-
-    // Search for desired record.
-    while ((TblFromRecId(pMap->GetToken()) == ixTbl) && (RidFromRecId(pMap->GetToken()) < iRid))
+    // StartENCMap recorded where each table's span of the map begins, and within
+    // a span the entries are sorted by logical RID, so binary search the span.
+    // ApplyDelta does one lookup per ENCLog record; a linear scan here made the
+    // overall apply quadratic in the size of the delta.
+    ULONG iLo = (*m_rENCRecs)[ixTbl];
+    ULONG iHi = (ixTbl + 1 < (ULONG)TBL_COUNT) ? (*m_rENCRecs)[ixTbl + 1]
+                                               : m_Schema.m_cRecs[TBL_ENCMap] + 1;
+
+    while (iLo < iHi)
     {
-        IfFailRet(GetENCMapRecord(++iMap, &pMap));
+        ULONG iMid = iLo + (iHi - iLo) / 2;
+        IfFailRet(GetENCMapRecord(iMid, &pMap));
+        if (RidFromRecId(pMap->GetToken()) < iRid)
+            iLo = iMid + 1;
+        else
+            iHi = iMid;
     }
 
+    // An out-of-range index here means the record is not in the map; let
+    // GetENCMapRecord report the failure.
+    iMap = iLo;
+    IfFailRet(GetENCMapRecord(iMap, &pMap));
+
     _ASSERTE((TblFromRecId(pMap->GetToken()) == ixTbl) && (RidFromRecId(pMap->GetToken()) == iRid));
 
     // Relative position within table's group in map is physical rid.
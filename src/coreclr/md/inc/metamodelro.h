@@ -61,6 +61,36 @@ public:
         return m_UserStringHeap.GetBlob(nIndex, pData);
     }
 
+    // Gets user string (*pData) at index (nIndex) and fills the index (*pnNextIndex) of the next user
+    // string in the heap - the read-only counterpart of code:CMiniMdRW::GetUserStringAndNextIndex.
+    // Returns S_FALSE (and clears the output parameters) if the index (nIndex) is not a valid user
+    // string index, error code on invalid heap data.
+    __checkReturn
+    HRESULT GetUserStringAndNextIndex(
+        UINT32              nIndex,
+        MetaData::DataBlob *pData,
+        UINT32             *pnNextIndex)
+    {
+        MINIMD_POSSIBLE_INTERNAL_POINTER_EXPOSED();
+        if (!m_UserStringHeap.IsValidIndex(nIndex))
+        {
+            pData->Clear();
+            *pnNextIndex = 0;
+            return S_FALSE;
+        }
+        HRESULT hr = m_UserStringHeap.GetBlob(nIndex, pData);
+        if (FAILED(hr))
+        {
+            pData->Clear();
+            *pnNextIndex = 0;
+            return hr;
+        }
+        // The read-only heap hands out the blob without its compressed size prefix, so
+        // recompute the prefix size to find the start of the next user string.
+        *pnNextIndex = nIndex + (UINT32)CPackedLen::Size(pData->GetSize()) + pData->GetSize();
+        return S_OK;
+    }
+
 protected:
     DAC_ALIGNAS(CMiniMdTemplate<CMiniMd>) // Align the first member to the alignment of the base class
     // Table info.
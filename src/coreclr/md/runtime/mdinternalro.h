@@ -586,6 +586,14 @@ public:
         BOOL    *pbIs80Plus,            // [OUT] specifies where there are extended characters >= 0x80.
         LPCWSTR *pwszUserString);
 
+    __checkReturn
+    STDMETHODIMP GetUserStringAndNextIndex(
+        ULONG    nIndex,                // [IN] heap index of the string.
+        ULONG   *pchString,             // [OUT] count of characters in the string.
+        BOOL    *pbIs80Plus,            // [OUT] specifies where there are extended characters >= 0x80.
+        LPCWSTR *pwszUserString,        // [OUT] the string, NULL if empty.
+        ULONG   *pnNextIndex);          // [OUT] heap index of the next string.
+
     //*****************************************************************************
     // p-invoke APIs.
     //*****************************************************************************
@@ -292,8 +292,35 @@ FORCEINLINE void InlinedBulkWriteBarrier(void* pMemStart, size_t cbMemSize)
     uint8_t* card = ((uint8_t*)VolatileLoadWithoutBarrier(&g_card_table)) + startingClump;
 
     // Fill the cards. To avoid cache line thrashing we check whether the cards have already been set before
-    // writing.
-    do
+    // writing. Large copies can cover a lot of cards, so once the card pointer is aligned we fill a whole
+    // word of cards per store instead of a byte.
+    if (clumpCount >= 2 * sizeof(size_t))
+    {
+        while (((size_t)card & (sizeof(size_t) - 1)) != 0)
+        {
+            if (*card != 0xff)
+            {
+                *card = 0xff;
+            }
+
+            card++;
+            clumpCount--;
+        }
+
+        while (clumpCount >= sizeof(size_t))
+        {
+            size_t* cardWord = (size_t*)card;
+            if (*cardWord != ~(size_t)0)
+            {
+                *cardWord = ~(size_t)0;
+            }
+
+            card += sizeof(size_t);
+            clumpCount -= sizeof(size_t);
+        }
+    }
+
+    while (clumpCount != 0)
     {
         if (*card != 0xff)
         {
@@ -303,7 +330,6 @@ FORCEINLINE void InlinedBulkWriteBarrier(void* pMemStart, size_t cbMemSize)
         card++;
         clumpCount--;
     }
-    while (clumpCount != 0);
 
 #ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
     size_t startBundleByte = startAddress >> card_bundle_byte_shift;
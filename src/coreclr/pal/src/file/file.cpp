@@ -634,6 +634,24 @@ CorUnix::InternalCreateFile(
     }
 #endif
 
+#ifdef POSIX_FADV_SEQUENTIAL
+    /* FILE_FLAG_SEQUENTIAL_SCAN and FILE_FLAG_RANDOM_ACCESS are access-pattern
+       hints on Windows; forward them to the kernel so readahead matches the
+       caller's stated pattern. The hint is advisory there too, so a failure
+       here is not an error. */
+    if ( dwFlagsAndAttributes & (FILE_FLAG_SEQUENTIAL_SCAN | FILE_FLAG_RANDOM_ACCESS) )
+    {
+        int advice = (dwFlagsAndAttributes & FILE_FLAG_SEQUENTIAL_SCAN) ?
+            POSIX_FADV_SEQUENTIAL : POSIX_FADV_RANDOM;
+        int fadviseError = posix_fadvise(filed, 0, 0, advice);
+        if (fadviseError != 0)
+        {
+            TRACE("posix_fadvise() failed; error is %s (%d)\n",
+                  strerror(fadviseError), fadviseError);
+        }
+    }
+#endif // POSIX_FADV_SEQUENTIAL
+
     /* make file descriptor close-on-exec; inheritable handles will get
       "uncloseonexeced" in CreateProcess if they are actually being inherited*/
     if(-1 == fcntl(filed,F_SETFD, FD_CLOEXEC))
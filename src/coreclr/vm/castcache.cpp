@@ -94,10 +94,79 @@ BOOL CastCache::MaybeReplaceCacheWithLarger(DWORD size)
         return FALSE;
     }
 
+    // Copy surviving entries from the current table so that growing does not restart
+    // the cache cold - cast-heavy workloads would otherwise pay the miss cost for every
+    // entry they had already computed.
+    //
+    // Note that this cannot resurrect entries across the assembly-unload flush: that
+    // flush runs with the EE suspended (see LoaderAllocator::GCLoaderAllocators), and
+    // there are no GC safe points between reading the source table below and publishing
+    // the new one, so the copy source is always the post-flush table in that case.
+    CopyTableEntries(TableData(*s_pTableRef), TableData(newTable));
+
     SetObjectReference((OBJECTREF *)s_pTableRef, newTable);
     return TRUE;
 }
 
+void CastCache::CopyTableEntries(DWORD* fromTable, DWORD* toTable)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    DWORD fromCount = CacheElementCount(fromTable);
+    for (DWORD i = 0; i < fromCount; i++)
+    {
+        CastCacheEntry* pFromEntry = &Elements(fromTable)[i];
+
+        // Snapshot the entry using the same protocol as TryGet. Writers may still be
+        // updating the old table while we copy; torn or in-progress entries are skipped,
+        // they will simply be recomputed and re-added on the next miss.
+        DWORD version1 = VolatileLoad(&pFromEntry->version);
+        if ((version1 == 0) || (version1 & 1))
+        {
+            // unclaimed or currently being written
+            continue;
+        }
+
+        TADDR source          = pFromEntry->source;
+        TADDR targetAndResult = pFromEntry->targetAndResult;
+
+        // make sure 'version' is loaded after 'source' and 'targetAndResult'
+        VolatileLoadBarrier();
+        if (version1 != pFromEntry->version)
+        {
+            // the entry changed while we were reading it
+            continue;
+        }
+
+        // The new table is not published yet, so plain writes are sufficient here.
+        DWORD index = KeyToBucket(toTable, source, targetAndResult & ~(TADDR)1);
+        for (DWORD d = 0; d < BUCKET_SIZE; d++)
+        {
+            CastCacheEntry* pToEntry = &Elements(toTable)[index];
+            if (pToEntry->version == 0)
+            {
+                pToEntry->source          = source;
+                pToEntry->targetAndResult = targetAndResult;
+
+                // a complete entry at distance 'd' with a single finished update
+                pToEntry->version = (d << VERSION_NUM_SIZE) + 2;
+                break;
+            }
+
+            // quadratic reprobe
+            index = (index + d + 1) & TableMask(toTable);
+        }
+
+        // if the bucket is full the entry is dropped - this is a lossy cache.
+    }
+}
+
 void CastCache::FlushCurrentCache()
 {
     CONTRACTL
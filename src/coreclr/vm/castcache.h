@@ -44,6 +44,8 @@
 //
 // Whenever we need to replace or resize the table, we simply allocate a new one and atomically
 // update the static handle. The old table may be still in use, but will eventually be collected by GC.
+// When growing, surviving entries are migrated into the new table before it is published, so a
+// resize does not restart the cache cold. Flushes (unloads, version saturation) still drop everything.
 //
 class CastCache
 {
@@ -318,6 +320,7 @@ private:
 
     static BASEARRAYREF CreateCastCache(DWORD size);
     static BOOL MaybeReplaceCacheWithLarger(DWORD size);
+    static void CopyTableEntries(DWORD* fromTable, DWORD* toTable);
     static TypeHandle::CastResult TryGet(TADDR source, TADDR target);
     static void TrySet(TADDR source, TADDR target, BOOL result);
 
@@ -2810,6 +2810,83 @@ OBJECTHANDLE ModuleBase::ResolveStringRef(DWORD token, void** ppPinnedString)
     return string;
 }
 
+// Eagerly interns every literal in this module's user string heap. The batch goes
+// through GlobalStringLiteralMap::PreloadStringLiterals, which lays the string
+// objects out contiguously on the frozen object heap and only takes the map's
+// lock once; the per-token ResolveStringRef path then finds the preloaded
+// entries already in the global map.
+void Module::PreloadStringLiterals()
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+        INJECT_FAULT(COMPlusThrowOM());
+    }
+    CONTRACTL_END;
+
+#if !BIGENDIAN
+    // Frozen entries in the global map are never freed, so don't pin down the
+    // literals of a module that can be unloaded. (On big endian targets the
+    // string data would have to be byte swapped a copy at a time, see
+    // InitializeStringData - those literals stay on the lazy path.)
+    if (GetLoaderAllocator()->CanUnload())
+        return;
+
+    if (g_pStringClass == NULL)
+    {
+        // Too early - string objects can't be allocated yet.
+        return;
+    }
+
+    IMDInternalImport *pImport = GetMDImport();
+
+    HRESULT hr;
+    ULONG chString;
+    LPCWSTR wszString;
+    ULONG nNextIndex;
+
+    // Count the strings so the batch can be sized up front.
+    DWORD count = 0;
+    ULONG nIndex = 0;
+    while ((hr = pImport->GetUserStringAndNextIndex(nIndex, &chString, NULL, &wszString, &nNextIndex)) == S_OK)
+    {
+        if (wszString != NULL)
+            count++;
+        nIndex = nNextIndex;
+    }
+
+    if (FAILED(hr) || (count == 0))
+        return;
+
+    NewArrayHolder<EEStringData> pStringDatas(new EEStringData[count]);
+
+    DWORD cStrings = 0;
+    nIndex = 0;
+    BOOL fIs80Plus;
+    while ((cStrings < count) &&
+           ((hr = pImport->GetUserStringAndNextIndex(nIndex, &chString, &fIs80Plus, &wszString, &nNextIndex)) == S_OK))
+    {
+        if (wszString != NULL)
+        {
+            pStringDatas[cStrings].SetStringBuffer(wszString);
+            pStringDatas[cStrings].SetCharCount(chString);
+            pStringDatas[cStrings].SetIsOnlyLowChars(!fIs80Plus);
+            cStrings++;
+        }
+        nIndex = nNextIndex;
+    }
+
+    if (cStrings == 0)
+        return;
+
+    GCX_COOP();
+    SystemDomain::GetGlobalStringLiteralMap()->PreloadStringLiterals(pStringDatas, cStrings);
+#endif // !BIGENDIAN
+}
+
 mdToken Module::GetEntryPointToken()
 {
     WRAPPER_NO_CONTRACT;
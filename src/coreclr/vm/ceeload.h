@@ -886,6 +886,10 @@ protected:
 
     void FixupVTables();
 
+    // Eagerly interns every literal in this module's user string heap in one
+    // frozen object heap batch. Gated by DOTNET_EagerStringLiterals.
+    void PreloadStringLiterals();
+
     void FreeClassTables();
 
 #ifdef DACCESS_COMPILE
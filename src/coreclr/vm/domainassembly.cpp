@@ -560,6 +560,20 @@ void DomainAssembly::FinishLoad()
     // typeloads can involve types from this module. (Used for candidate instantiations.)
     GetModule()->SetIsReadyForTypeLoad();
 
+    if (g_pConfig->EagerStringLiterals())
+    {
+        EX_TRY
+        {
+            GetModule()->PreloadStringLiterals();
+        }
+        EX_CATCH
+        {
+            // Preloading is an optimization only - on failure the module's
+            // literals are interned lazily as usual.
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+    }
+
 #ifdef FEATURE_PERFMAP
     // Notify the perfmap of the IL image load.
     PerfMap::LogImageLoad(m_pPEAssembly);
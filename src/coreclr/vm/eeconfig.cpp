@@ -118,6 +118,7 @@ HRESULT EEConfig::Init()
     fStressLog = false;
     fForceEnc = false;
     fProbeForStackOverflow = true;
+    fEagerStringLiterals = false;
 
     INDEBUG(fStressLog = true;)
 
@@ -623,6 +624,8 @@ HRESULT EEConfig::sync()
     fExpandAllOnLoad = (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ExpandAllOnLoad) != 0);
 #endif //_DEBUG
 
+    fEagerStringLiterals = (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_EagerStringLiterals) != 0);
+
 #ifdef ENABLE_STARTUP_DELAY
     {
         //I want this string in decimal
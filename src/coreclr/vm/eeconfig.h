@@ -315,6 +315,8 @@ public:
         return fProbeForStackOverflow;
     }
 
+    bool EagerStringLiterals(void) const { LIMITED_METHOD_CONTRACT; return fEagerStringLiterals; }
+
 #ifdef TEST_DATA_CONSISTENCY
     // get the value of fTestDataConsistency, which controls whether we test that we can correctly detect
     // held locks in DAC builds. This is determined by an environment variable.
@@ -614,6 +616,8 @@ private: //----------------------------------------------------------------
     bool fDebugAssembliesModifiable;
     bool fProbeForStackOverflow;
 
+    bool fEagerStringLiterals;          // Eagerly intern each module's string literals at load time.
+
     // Stackwalk optimization flag
     DWORD dwDisableStackwalkCache;
 
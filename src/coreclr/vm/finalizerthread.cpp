@@ -92,25 +92,50 @@ void FinalizerThread::FinalizeAllObjects()
 
     unsigned int fcount = 0;
 
-    Object* fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+    // Dequeueing a batch at a time amortizes the synchronization with the GC's
+    // finalize queues over FINALIZER_BATCH_SIZE objects. The batch has to be
+    // GC-protected because running one finalizer can trigger a GC while the
+    // rest of the batch is still pending.
+    const size_t FINALIZER_BATCH_SIZE = 16;
+    Object* fobjs[FINALIZER_BATCH_SIZE];
+    OBJECTREF batch[FINALIZER_BATCH_SIZE];
+    ZeroMemory(batch, sizeof(batch));
+
+    size_t fetched = GCHeapUtilities::GetGCHeap()->GetNextFinalizableObjects(fobjs, FINALIZER_BATCH_SIZE);
 
     Thread *pThread = GetThread();
 
+    GCPROTECT_ARRAY_BEGIN(batch[0], FINALIZER_BATCH_SIZE);
+
     // Finalize everyone
-    while (fobj && !fQuitFinalizer)
+    while ((fetched != 0) && !fQuitFinalizer)
     {
-        fcount++;
+        for (size_t i = 0; i < fetched; i++)
+        {
+            batch[i] = ObjectToOBJECTREF(fobjs[i]);
+        }
+
+        for (size_t i = 0; (i < fetched) && !fQuitFinalizer; i++)
+        {
+            fcount++;
 
-        CallFinalizer(fobj);
+            CallFinalizer(OBJECTREFToObject(batch[i]));
+            batch[i] = NULL;
 
-        // thread abort could be injected by the debugger,
-        // but should not be allowed to "leak" out of expression evaluation
-        _ASSERTE(!GetFinalizerThread()->IsAbortRequested());
+            // thread abort could be injected by the debugger,
+            // but should not be allowed to "leak" out of expression evaluation
+            _ASSERTE(!GetFinalizerThread()->IsAbortRequested());
 
-        pThread->InternalReset();
+            pThread->InternalReset();
+        }
 
-        fobj = GCHeapUtilities::GetGCHeap()->GetNextFinalizable();
+        if (fQuitFinalizer)
+            break;
+
+        fetched = GCHeapUtilities::GetGCHeap()->GetNextFinalizableObjects(fobjs, FINALIZER_BATCH_SIZE);
     }
+    GCPROTECT_END();
+
     FireEtwGCFinalizersEnd_V1(fcount, GetClrInstanceId());
 }
 
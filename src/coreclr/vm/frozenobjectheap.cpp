@@ -118,6 +118,140 @@ Object* FrozenObjectHeapManager::TryAllocateObject(PTR_MethodTable type, size_t
 #endif // !FEATURE_BASICFREEZE
 }
 
+// Allocates a batch of objects of the given type on frozen segments, taking the allocator
+// lock and notifying the GC about segment changes only once for the whole batch so the
+// objects end up laid out contiguously. Sizes are expected to include headers. Objects
+// that are too large for the frozen heap get a nullptr slot and the caller is responsible
+// for allocating them on a normal heap. Returns the number of objects allocated.
+
+size_t FrozenObjectHeapManager::TryAllocateObjects(PTR_MethodTable type, const size_t* pObjectSizes, size_t count,
+    Object** pObjects, void(*initFunc)(Object*, size_t, void*), void* pParam)
+{
+    CONTRACTL
+    {
+        THROWS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END
+
+    memset(pObjects, 0, count * sizeof(Object*));
+
+#ifndef FEATURE_BASICFREEZE
+    // GC is required to support frozen segments
+    return 0;
+#else // FEATURE_BASICFREEZE
+
+    _ASSERT(type != nullptr);
+
+#ifdef FEATURE_64BIT_ALIGNMENT
+    if (type->RequiresAlign8())
+    {
+        // Align8 objects are not supported yet
+        return 0;
+    }
+#endif
+
+    size_t allocated = 0;
+
+    {
+        GCX_PREEMP();
+
+        // Segments this batch fills up. Once we roll past a segment it can only be
+        // mutated by us, so it is safe to register it after m_Crst is released.
+        StackSArray<FrozenObjectSegment*> filledSegments;
+
+        FrozenObjectSegment* curSeg = nullptr;
+        uint8_t* curSegmentCurrent = nullptr;
+        size_t curSegSizeCommitted = 0;
+
+        {
+            CrstHolder ch(&m_Crst);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                const size_t objectSize = pObjectSizes[i];
+
+                // NOTE: objectSize is expected be the full size including header
+                _ASSERT(objectSize >= MIN_OBJECT_SIZE);
+
+                if (objectSize > FOH_COMMIT_SIZE)
+                {
+                    // Same policy as TryAllocateObject - since FrozenObjectHeap is just
+                    // an optimization, let's not fill it with huge objects.
+                    continue;
+                }
+
+                Object* obj = m_CurrentSegment == nullptr ? nullptr : m_CurrentSegment->TryAllocateObject(type, objectSize);
+                // obj is nullptr if the current segment is full or hasn't been allocated yet
+                if (obj == nullptr)
+                {
+                    size_t newSegmentSize = FOH_SEGMENT_DEFAULT_SIZE;
+                    if (m_CurrentSegment != nullptr)
+                    {
+                        // Double the reserved size to reduce the number of frozen segments in apps with lots of frozen objects
+                        // Use the same size in case if prevSegmentSize*2 operation overflows.
+                        const size_t prevSegmentSize = m_CurrentSegment->m_Size;
+                        newSegmentSize = max(prevSegmentSize, prevSegmentSize * 2);
+
+                        // The outgoing segment is final now - remember it for registration.
+                        filledSegments.Append(m_CurrentSegment);
+                    }
+
+                    m_CurrentSegment = new FrozenObjectSegment(newSegmentSize);
+                    m_FrozenSegments.Append(m_CurrentSegment);
+
+                    // Try again
+                    obj = m_CurrentSegment->TryAllocateObject(type, objectSize);
+
+                    // This time it's not expected to be null
+                    _ASSERT(obj != nullptr);
+                }
+
+                if (initFunc != nullptr)
+                {
+                    initFunc(obj, i, pParam);
+                }
+
+                pObjects[i] = obj;
+                allocated++;
+            }
+
+            curSeg = m_CurrentSegment;
+            if (curSeg != nullptr)
+            {
+                curSegSizeCommitted = curSeg->m_SizeCommitted;
+                curSegmentCurrent = curSeg->m_pCurrent;
+            }
+        } // end of m_Crst lock
+
+        if (allocated > 0)
+        {
+            // Let GC know about the new segments or changes in them - once for the whole batch.
+            // We do it under a new lock because the main one (m_Crst) can be used by Profiler in a GC's thread
+            // and that might cause deadlocks since RegisterFrozenSegment may stuck on GC's lock.
+            CrstHolder regLock(&m_SegmentRegistrationCrst);
+            for (COUNT_T segIdx = 0; segIdx < filledSegments.GetCount(); segIdx++)
+            {
+                FrozenObjectSegment* seg = filledSegments[segIdx];
+                seg->RegisterOrUpdate(seg->m_pCurrent, seg->m_SizeCommitted);
+            }
+            curSeg->RegisterOrUpdate(curSegmentCurrent, curSegSizeCommitted);
+        }
+
+    } // end of GCX_PREEMP
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (pObjects[i] != nullptr)
+        {
+            PublishFrozenObject(pObjects[i]);
+        }
+    }
+
+    return allocated;
+#endif // !FEATURE_BASICFREEZE
+}
+
 // Reserve sizeHint bytes of memory for the given frozen segment.
 // The requested size can be be ignored in case of memory pressure and FOH_SEGMENT_DEFAULT_SIZE is used instead.
 FrozenObjectSegment::FrozenObjectSegment(size_t sizeHint) :
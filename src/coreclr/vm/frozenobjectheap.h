@@ -29,6 +29,8 @@ public:
     FrozenObjectHeapManager();
     Object* TryAllocateObject(PTR_MethodTable type, size_t objectSize,
         void(*initFunc)(Object*,void*) = nullptr, void* pParam = nullptr);
+    size_t TryAllocateObjects(PTR_MethodTable type, const size_t* pObjectSizes, size_t count, Object** pObjects,
+        void(*initFunc)(Object*,size_t,void*) = nullptr, void* pParam = nullptr);
 
 private:
     Crst m_Crst;
@@ -147,6 +147,39 @@ inline OBJECTHANDLE CreateDependentHandle(IGCHandleStore* store, OBJECTREF prima
     return hnd;
 }
 
+// Batch handle creation convenience functions
+inline void CreateHandlesCommon(IGCHandleStore* store, OBJECTREF* pObjects, OBJECTHANDLE* pHandles, uint32_t count, HandleType type)
+{
+    // an OBJECTREF is just a wrapper over a raw Object* (see OBJECTREF_TO_UNCHECKED_OBJECTREF),
+    // so the object array can be handed to the GC directly.
+    uint32_t created = store->CreateHandlesOfType((Object**)pObjects, type, pHandles, count);
+    if (created != count)
+    {
+        // unwind the partial batch before reporting the failure
+        for (uint32_t i = 0; i < created; i++)
+        {
+            GCHandleUtilities::GetGCHandleManager()->DestroyHandleOfType(pHandles[i], type);
+        }
+
+        COMPlusThrowOM();
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        DiagHandleCreated(pHandles[i], pObjects[i]);
+    }
+}
+
+inline void CreateStrongHandles(IGCHandleStore* store, OBJECTREF* pObjects, OBJECTHANDLE* pHandles, uint32_t count)
+{
+    CreateHandlesCommon(store, pObjects, pHandles, count, HNDTYPE_STRONG);
+}
+
+inline void CreatePinningHandles(IGCHandleStore* store, OBJECTREF* pObjects, OBJECTHANDLE* pHandles, uint32_t count)
+{
+    CreateHandlesCommon(store, pObjects, pHandles, count, HNDTYPE_PINNED);
+}
+
 // Global handle creation convenience functions
 inline OBJECTHANDLE CreateGlobalHandleCommon(OBJECTREF object, HandleType type)
 {
@@ -327,6 +360,36 @@ inline void DestroyTypedHandle(OBJECTHANDLE handle)
     GCHandleUtilities::GetGCHandleManager()->DestroyHandleOfUnknownType(handle);
 }
 
+// Batch handle destruction convenience functions
+inline void DestroyHandlesCommon(OBJECTHANDLE* pHandles, uint32_t count, HandleType type)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        DiagHandleDestroyed(pHandles[i]);
+    }
+
+    GCHandleUtilities::GetGCHandleManager()->DestroyHandlesOfType(pHandles, count, type);
+}
+
+inline void DestroyStrongHandles(OBJECTHANDLE* pHandles, uint32_t count)
+{
+    DestroyHandlesCommon(pHandles, count, HNDTYPE_STRONG);
+}
+
+inline void DestroyPinningHandles(OBJECTHANDLE* pHandles, uint32_t count)
+{
+    DestroyHandlesCommon(pHandles, count, HNDTYPE_PINNED);
+}
+
 // Handle holders/wrappers
 
 #ifndef FEATURE_NATIVEAOT
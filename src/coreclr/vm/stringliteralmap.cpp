@@ -11,6 +11,7 @@
 #include "common.h"
 #include "eeconfig.h"
 #include "stringliteralmap.h"
+#include "frozenobjectheap.h"
 
 /*
     Thread safety in GlobalStringLiteralMap / StringLiteralMap
@@ -538,6 +539,82 @@ StringLiteralEntry *GlobalStringLiteralMap::AddStringLiteral(EEStringData *pStri
     return pRet;
 }
 
+void GlobalStringLiteralMap::PreloadStringLiterals(EEStringData *pStringDatas, DWORD count)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        PRECONDITION(CheckPointer(this));
+        PRECONDITION(CheckPointer(pStringDatas));
+    }
+    CONTRACTL_END;
+
+    NewArrayHolder<EEStringData*> pPending(new EEStringData*[count]);
+    NewArrayHolder<size_t> pSizes(new size_t[count]);
+    NewArrayHolder<Object*> pObjects(new Object*[count]);
+
+    CrstHolder gch(&m_HashTableCrstGlobal);
+
+    // Collect the literals that aren't interned yet.
+    DWORD pending = 0;
+    for (DWORD i = 0; i < count; i++)
+    {
+        EEStringData *pStringData = &pStringDatas[i];
+        DWORD dwHash = m_StringToEntryHashTable->GetHash(pStringData);
+
+        HashDatum Data;
+        if (m_StringToEntryHashTable->GetValueSpeculative(pStringData, &Data, dwHash)) // Since we hold the critical section here, we can safely use the speculative variant of GetValue
+        {
+            continue;
+        }
+
+        pPending[pending] = pStringData;
+        pSizes[pending] = PtrAlign(StringObject::GetSize(pStringData->GetCharCount()));
+        pending++;
+    }
+
+    if (pending == 0)
+    {
+        return;
+    }
+
+    // Allocate the whole batch on the frozen object heap in one go, so the literals
+    // end up contiguous and the allocator's lock is only taken once.
+    FrozenObjectHeapManager* foh = SystemDomain::GetFrozenObjectHeapManager();
+    foh->TryAllocateObjects(g_pStringClass, pSizes, pending, pObjects,
+        [](Object* obj, size_t index, void* pParam) {
+            // Initialize newly allocated object before publish
+            EEStringData *pStringData = ((EEStringData**)pParam)[index];
+            StringObject* strObj = static_cast<StringObject*>(obj);
+            strObj->SetStringLength(pStringData->GetCharCount());
+            memcpyNoGCRefs(strObj->GetBuffer(), pStringData->GetStringBuffer(),
+                pStringData->GetCharCount() * sizeof(WCHAR));
+            // Frozen segment memory is committed zero-filled, so the buffer is
+            // already null terminated.
+        }, (void*)pPending.GetValue());
+
+    for (DWORD i = 0; i < pending; i++)
+    {
+        if (pObjects[i] == nullptr)
+        {
+            // Didn't fit on the frozen heap - the literal will be interned lazily
+            // through the regular GetStringLiteral path.
+            continue;
+        }
+
+        StringLiteralEntryHolder pEntry(StringLiteralEntry::AllocateFrozenEntry(
+            pPending[i], ObjectToSTRINGREF(static_cast<StringObject*>(pObjects[i]))));
+        m_StringToEntryHashTable->InsertValue(pPending[i], pEntry, FALSE);
+        pEntry.SuppressRelease();
+
+#ifdef LOGGING
+        LogStringLiteral("preloaded", pPending[i]);
+#endif
+    }
+}
+
 StringLiteralEntry *GlobalStringLiteralMap::AddInternedString(STRINGREF *pString)
 {
 
@@ -76,6 +76,11 @@ public:
     // Method to explicitly intern a string object. Takes a precomputed hash (for perf).
     StringLiteralEntry *GetInternedString(STRINGREF *pString, DWORD dwHash, BOOL bAddIfNotFound);
 
+    // Method to intern a whole batch of literals (e.g. a module's string table) at once.
+    // The string objects are laid out contiguously on the frozen object heap and the map's
+    // lock is only taken once for the batch.
+    void PreloadStringLiterals(EEStringData *pStringDatas, DWORD count);
+
     // Method to calculate the hash
     DWORD GetHash(EEStringData* pData)
     {
@@ -1403,6 +1403,13 @@ mono_image_storage_open (const char *fname)
 #endif
 	mono_file_map_close (filed);
 
+	/*
+	 * The metadata is read mostly front to back while the image loads; ask the
+	 * OS to read it ahead instead of faulting the mapping in page by page.
+	 */
+	if (storage->raw_data)
+		mono_file_map_advise_prefetch (storage->raw_data, storage->raw_data_len);
+
 	storage->key = key;
 
 	MonoImageStorage *other_storage = NULL;
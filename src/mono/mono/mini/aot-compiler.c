@@ -13956,6 +13956,101 @@ add_profile_instances (MonoAotCompile *acfg, ProfileData *data)
 	printf ("Added %d methods from profile.\n", count);
 }
 
+typedef struct {
+	guint32 method_index;
+	/* (profile file ordinal << 32) | record id, i.e. ascending first-use order */
+	guint64 order_key;
+} MethodOrderEntry;
+
+static int
+compare_method_order_entries (const void *a, const void *b)
+{
+	const MethodOrderEntry *ea = (const MethodOrderEntry*)a;
+	const MethodOrderEntry *eb = (const MethodOrderEntry*)b;
+
+	if (ea->order_key < eb->order_key)
+		return -1;
+	if (ea->order_key > eb->order_key)
+		return 1;
+	return 0;
+}
+
+/*
+ * order_methods_by_profile:
+ *
+ *   Reorder ACFG->method_order so the methods recorded in the profile are emitted
+ * first, in the order the profiler first jitted them. The runtime locates code
+ * through tables indexed by method index, so emission order is free to differ
+ * from index order. Laying out startup methods contiguously in first-use order
+ * turns the scattered page faults of a cold start on the AOT image into mostly
+ * sequential reads. The record ids in the profile data are assigned in jit
+ * order, so they encode first-use time.
+ */
+static void
+order_methods_by_profile (MonoAotCompile *acfg)
+{
+	GHashTable *ordered;
+	GArray *entries;
+	GPtrArray *new_order;
+	GList *l;
+	guint64 file_ordinal = 0;
+
+	/* method index + 1 of the methods given a position below */
+	ordered = g_hash_table_new (NULL, NULL);
+	entries = g_array_new (FALSE, FALSE, sizeof (MethodOrderEntry));
+
+	for (l = acfg->profile_data; l; l = l->next, ++file_ordinal) {
+		ProfileData *data = (ProfileData*)l->data;
+		GHashTableIter iter;
+		gpointer key, value;
+
+		g_hash_table_iter_init (&iter, data->methods);
+		while (g_hash_table_iter_next (&iter, &key, &value)) {
+			MethodProfileData *mdata = (MethodProfileData*)value;
+			guint32 index;
+			MethodOrderEntry entry;
+
+			if (!mdata->method)
+				continue;
+			index = GPOINTER_TO_UINT (g_hash_table_lookup (acfg->method_indexes, mdata->method));
+			if (!index)
+				continue;
+			/* A method can show up in several profile files, the earliest file wins */
+			if (g_hash_table_lookup (ordered, GUINT_TO_POINTER (index)))
+				continue;
+			g_hash_table_insert (ordered, GUINT_TO_POINTER (index), GUINT_TO_POINTER (1));
+
+			entry.method_index = index - 1;
+			entry.order_key = (file_ordinal << 32) | (guint32)mdata->id;
+			g_array_append_val (entries, entry);
+		}
+	}
+
+	if (entries->len) {
+		mono_qsort (entries->data, entries->len, sizeof (MethodOrderEntry), compare_method_order_entries);
+
+		new_order = g_ptr_array_sized_new (acfg->method_order->len);
+		for (guint i = 0; i < entries->len; ++i) {
+			MethodOrderEntry *entry = &g_array_index (entries, MethodOrderEntry, i);
+			g_ptr_array_add (new_order, GUINT_TO_POINTER (entry->method_index));
+		}
+		/* The rest of the methods keep their relative order */
+		for (guint i = 0; i < acfg->method_order->len; ++i) {
+			guint32 index = GPOINTER_TO_UINT (g_ptr_array_index (acfg->method_order, i));
+
+			if (!g_hash_table_lookup (ordered, GUINT_TO_POINTER (index + 1)))
+				g_ptr_array_add (new_order, GUINT_TO_POINTER (index));
+		}
+		g_ptr_array_free (acfg->method_order, TRUE);
+		acfg->method_order = new_order;
+
+		aot_printf (acfg, "Ordered %d methods from the profile first.\n", entries->len);
+	}
+
+	g_array_free (entries, TRUE);
+	g_hash_table_destroy (ordered);
+}
+
 typedef enum {
 	FIND_METHOD_TYPE_ENTRY_START,
 	FIND_METHOD_TYPE_ENTRY_END,
@@ -15520,6 +15615,9 @@ emit_aot_image (MonoAotCompile *acfg)
 	if (acfg->dwarf)
 		mono_dwarf_writer_emit_base_info (acfg->dwarf, g_path_get_basename (acfg->image->name), mono_unwind_get_cie_program ());
 
+	if (acfg->profile_data)
+		order_methods_by_profile (acfg);
+
 	emit_code (acfg);
 
 	emit_method_info_table (acfg);
@@ -276,6 +276,23 @@ interp_v128_op_ones_complement (gpointer res, gpointer v1)
 }
 
 // WidenLower
+static void
+interp_v128_i2_widen_lower (gpointer res, gpointer v1)
+{
+	gint16 *res_typed = (gint16*)res;
+	guint64 lower_copy = *(guint64*)v1;
+	gint8 *v1_typed = (gint8*)&lower_copy;
+
+	res_typed [0] = v1_typed [0];
+	res_typed [1] = v1_typed [1];
+	res_typed [2] = v1_typed [2];
+	res_typed [3] = v1_typed [3];
+	res_typed [4] = v1_typed [4];
+	res_typed [5] = v1_typed [5];
+	res_typed [6] = v1_typed [6];
+	res_typed [7] = v1_typed [7];
+}
+
 static void
 interp_v128_u2_widen_lower (gpointer res, gpointer v1)
 {
@@ -293,7 +310,83 @@ interp_v128_u2_widen_lower (gpointer res, gpointer v1)
         res_typed [7] = v1_typed [7];
 }
 
+static void
+interp_v128_i4_widen_lower (gpointer res, gpointer v1)
+{
+	gint32 *res_typed = (gint32*)res;
+	guint64 lower_copy = *(guint64*)v1;
+	gint16 *v1_typed = (gint16*)&lower_copy;
+
+	res_typed [0] = v1_typed [0];
+	res_typed [1] = v1_typed [1];
+	res_typed [2] = v1_typed [2];
+	res_typed [3] = v1_typed [3];
+}
+
+static void
+interp_v128_u4_widen_lower (gpointer res, gpointer v1)
+{
+	guint32 *res_typed = (guint32*)res;
+	guint64 lower_copy = *(guint64*)v1;
+	guint16 *v1_typed = (guint16*)&lower_copy;
+
+	res_typed [0] = v1_typed [0];
+	res_typed [1] = v1_typed [1];
+	res_typed [2] = v1_typed [2];
+	res_typed [3] = v1_typed [3];
+}
+
+static void
+interp_v128_i8_widen_lower (gpointer res, gpointer v1)
+{
+	gint64 *res_typed = (gint64*)res;
+	guint64 lower_copy = *(guint64*)v1;
+	gint32 *v1_typed = (gint32*)&lower_copy;
+
+	res_typed [0] = v1_typed [0];
+	res_typed [1] = v1_typed [1];
+}
+
+static void
+interp_v128_u8_widen_lower (gpointer res, gpointer v1)
+{
+	guint64 *res_typed = (guint64*)res;
+	guint64 lower_copy = *(guint64*)v1;
+	guint32 *v1_typed = (guint32*)&lower_copy;
+
+	res_typed [0] = v1_typed [0];
+	res_typed [1] = v1_typed [1];
+}
+
+static void
+interp_v128_r8_widen_lower (gpointer res, gpointer v1)
+{
+	double *res_typed = (double*)res;
+	guint64 lower_copy = *(guint64*)v1;
+	float *v1_typed = (float*)&lower_copy;
+
+	res_typed [0] = v1_typed [0];
+	res_typed [1] = v1_typed [1];
+}
+
 // WidenUpper
+static void
+interp_v128_i2_widen_upper (gpointer res, gpointer v1)
+{
+	gint16 *res_typed = (gint16*)res;
+	guint64 upper_copy = *((guint64*)v1 + 1);
+	gint8 *v1_typed = (gint8*)&upper_copy;
+
+	res_typed [0] = v1_typed [0];
+	res_typed [1] = v1_typed [1];
+	res_typed [2] = v1_typed [2];
+	res_typed [3] = v1_typed [3];
+	res_typed [4] = v1_typed [4];
+	res_typed [5] = v1_typed [5];
+	res_typed [6] = v1_typed [6];
+	res_typed [7] = v1_typed [7];
+}
+
 static void
 interp_v128_u2_widen_upper (gpointer res, gpointer v1)
 {
@@ -311,7 +404,112 @@ interp_v128_u2_widen_upper (gpointer res, gpointer v1)
         res_typed [7] = v1_typed [7];
 }
 
+static void
+interp_v128_i4_widen_upper (gpointer res, gpointer v1)
+{
+	gint32 *res_typed = (gint32*)res;
+	guint64 upper_copy = *((guint64*)v1 + 1);
+	gint16 *v1_typed = (gint16*)&upper_copy;
+
+	res_typed [0] = v1_typed [0];
+	res_typed [1] = v1_typed [1];
+	res_typed [2] = v1_typed [2];
+	res_typed [3] = v1_typed [3];
+}
+
+static void
+interp_v128_u4_widen_upper (gpointer res, gpointer v1)
+{
+	guint32 *res_typed = (guint32*)res;
+	guint64 upper_copy = *((guint64*)v1 + 1);
+	guint16 *v1_typed = (guint16*)&upper_copy;
+
+	res_typed [0] = v1_typed [0];
+	res_typed [1] = v1_typed [1];
+	res_typed [2] = v1_typed [2];
+	res_typed [3] = v1_typed [3];
+}
+
+static void
+interp_v128_i8_widen_upper (gpointer res, gpointer v1)
+{
+	gint64 *res_typed = (gint64*)res;
+	guint64 upper_copy = *((guint64*)v1 + 1);
+	gint32 *v1_typed = (gint32*)&upper_copy;
+
+	res_typed [0] = v1_typed [0];
+	res_typed [1] = v1_typed [1];
+}
+
+static void
+interp_v128_u8_widen_upper (gpointer res, gpointer v1)
+{
+	guint64 *res_typed = (guint64*)res;
+	guint64 upper_copy = *((guint64*)v1 + 1);
+	guint32 *v1_typed = (guint32*)&upper_copy;
+
+	res_typed [0] = v1_typed [0];
+	res_typed [1] = v1_typed [1];
+}
+
+static void
+interp_v128_r8_widen_upper (gpointer res, gpointer v1)
+{
+	double *res_typed = (double*)res;
+	guint64 upper_copy = *((guint64*)v1 + 1);
+	float *v1_typed = (float*)&upper_copy;
+
+	res_typed [0] = v1_typed [0];
+	res_typed [1] = v1_typed [1];
+}
+
 // Narrow
+static void
+interp_v128_i1_narrow (gpointer res, gpointer v1, gpointer v2)
+{
+	gint8 *res_typed = (gint8*)res;
+	gint16 *v1_typed = (gint16*)v1;
+	gint16 *v2_typed = (gint16*)v2;
+
+	if (res != v2) {
+		res_typed [0] = v1_typed [0];
+		res_typed [1] = v1_typed [1];
+		res_typed [2] = v1_typed [2];
+		res_typed [3] = v1_typed [3];
+		res_typed [4] = v1_typed [4];
+		res_typed [5] = v1_typed [5];
+		res_typed [6] = v1_typed [6];
+		res_typed [7] = v1_typed [7];
+
+		res_typed [8] = v2_typed [0];
+		res_typed [9] = v2_typed [1];
+		res_typed [10] = v2_typed [2];
+		res_typed [11] = v2_typed [3];
+		res_typed [12] = v2_typed [4];
+		res_typed [13] = v2_typed [5];
+		res_typed [14] = v2_typed [6];
+		res_typed [15] = v2_typed [7];
+	} else {
+		res_typed [15] = v2_typed [7];
+		res_typed [14] = v2_typed [6];
+		res_typed [13] = v2_typed [5];
+		res_typed [12] = v2_typed [4];
+		res_typed [11] = v2_typed [3];
+		res_typed [10] = v2_typed [2];
+		res_typed [9] = v2_typed [1];
+		res_typed [8] = v2_typed [0];
+
+		res_typed [0] = v1_typed [0];
+		res_typed [1] = v1_typed [1];
+		res_typed [2] = v1_typed [2];
+		res_typed [3] = v1_typed [3];
+		res_typed [4] = v1_typed [4];
+		res_typed [5] = v1_typed [5];
+		res_typed [6] = v1_typed [6];
+		res_typed [7] = v1_typed [7];
+	}
+}
+
 static void
 interp_v128_u1_narrow (gpointer res, gpointer v1, gpointer v2)
 {
@@ -358,6 +556,132 @@ interp_v128_u1_narrow (gpointer res, gpointer v1, gpointer v2)
 	}
 }
 
+static void
+interp_v128_i2_narrow (gpointer res, gpointer v1, gpointer v2)
+{
+	gint16 *res_typed = (gint16*)res;
+	gint32 *v1_typed = (gint32*)v1;
+	gint32 *v2_typed = (gint32*)v2;
+
+	if (res != v2) {
+		res_typed [0] = v1_typed [0];
+		res_typed [1] = v1_typed [1];
+		res_typed [2] = v1_typed [2];
+		res_typed [3] = v1_typed [3];
+
+		res_typed [4] = v2_typed [0];
+		res_typed [5] = v2_typed [1];
+		res_typed [6] = v2_typed [2];
+		res_typed [7] = v2_typed [3];
+	} else {
+		res_typed [7] = v2_typed [3];
+		res_typed [6] = v2_typed [2];
+		res_typed [5] = v2_typed [1];
+		res_typed [4] = v2_typed [0];
+
+		res_typed [0] = v1_typed [0];
+		res_typed [1] = v1_typed [1];
+		res_typed [2] = v1_typed [2];
+		res_typed [3] = v1_typed [3];
+	}
+}
+
+static void
+interp_v128_u2_narrow (gpointer res, gpointer v1, gpointer v2)
+{
+	guint16 *res_typed = (guint16*)res;
+	guint32 *v1_typed = (guint32*)v1;
+	guint32 *v2_typed = (guint32*)v2;
+
+	if (res != v2) {
+		res_typed [0] = v1_typed [0];
+		res_typed [1] = v1_typed [1];
+		res_typed [2] = v1_typed [2];
+		res_typed [3] = v1_typed [3];
+
+		res_typed [4] = v2_typed [0];
+		res_typed [5] = v2_typed [1];
+		res_typed [6] = v2_typed [2];
+		res_typed [7] = v2_typed [3];
+	} else {
+		res_typed [7] = v2_typed [3];
+		res_typed [6] = v2_typed [2];
+		res_typed [5] = v2_typed [1];
+		res_typed [4] = v2_typed [0];
+
+		res_typed [0] = v1_typed [0];
+		res_typed [1] = v1_typed [1];
+		res_typed [2] = v1_typed [2];
+		res_typed [3] = v1_typed [3];
+	}
+}
+
+static void
+interp_v128_i4_narrow (gpointer res, gpointer v1, gpointer v2)
+{
+	gint32 *res_typed = (gint32*)res;
+	gint64 *v1_typed = (gint64*)v1;
+	gint64 *v2_typed = (gint64*)v2;
+
+	if (res != v2) {
+		res_typed [0] = v1_typed [0];
+		res_typed [1] = v1_typed [1];
+
+		res_typed [2] = v2_typed [0];
+		res_typed [3] = v2_typed [1];
+	} else {
+		res_typed [3] = v2_typed [1];
+		res_typed [2] = v2_typed [0];
+
+		res_typed [0] = v1_typed [0];
+		res_typed [1] = v1_typed [1];
+	}
+}
+
+static void
+interp_v128_u4_narrow (gpointer res, gpointer v1, gpointer v2)
+{
+	guint32 *res_typed = (guint32*)res;
+	guint64 *v1_typed = (guint64*)v1;
+	guint64 *v2_typed = (guint64*)v2;
+
+	if (res != v2) {
+		res_typed [0] = v1_typed [0];
+		res_typed [1] = v1_typed [1];
+
+		res_typed [2] = v2_typed [0];
+		res_typed [3] = v2_typed [1];
+	} else {
+		res_typed [3] = v2_typed [1];
+		res_typed [2] = v2_typed [0];
+
+		res_typed [0] = v1_typed [0];
+		res_typed [1] = v1_typed [1];
+	}
+}
+
+static void
+interp_v128_r4_narrow (gpointer res, gpointer v1, gpointer v2)
+{
+	float *res_typed = (float*)res;
+	double *v1_typed = (double*)v1;
+	double *v2_typed = (double*)v2;
+
+	if (res != v2) {
+		res_typed [0] = (float)v1_typed [0];
+		res_typed [1] = (float)v1_typed [1];
+
+		res_typed [2] = (float)v2_typed [0];
+		res_typed [3] = (float)v2_typed [1];
+	} else {
+		res_typed [3] = (float)v2_typed [1];
+		res_typed [2] = (float)v2_typed [0];
+
+		res_typed [0] = (float)v1_typed [0];
+		res_typed [1] = (float)v1_typed [1];
+	}
+}
+
 // GreaterThan
 static void
 interp_v128_u1_greater_than (gpointer res, gpointer v1, gpointer v2)
@@ -442,7 +442,13 @@ emit_sri_vector128 (TransformData *td, MonoMethod *cmethod, MonoMethodSignature
 			break;
 		case SN_Narrow:
 			simd_opcode = MINT_SIMD_INTRINS_P_PP;
-			if (atype == MONO_TYPE_U1) simd_intrins = INTERP_SIMD_INTRINSIC_V128_U1_NARROW;
+			if (atype == MONO_TYPE_I1) simd_intrins = INTERP_SIMD_INTRINSIC_V128_I1_NARROW;
+			else if (atype == MONO_TYPE_U1) simd_intrins = INTERP_SIMD_INTRINSIC_V128_U1_NARROW;
+			else if (atype == MONO_TYPE_I2) simd_intrins = INTERP_SIMD_INTRINSIC_V128_I2_NARROW;
+			else if (atype == MONO_TYPE_U2) simd_intrins = INTERP_SIMD_INTRINSIC_V128_U2_NARROW;
+			else if (atype == MONO_TYPE_I4) simd_intrins = INTERP_SIMD_INTRINSIC_V128_I4_NARROW;
+			else if (atype == MONO_TYPE_U4) simd_intrins = INTERP_SIMD_INTRINSIC_V128_U4_NARROW;
+			else if (atype == MONO_TYPE_R4) simd_intrins = INTERP_SIMD_INTRINSIC_V128_R4_NARROW;
 			break;
 		case SN_ShiftLeft:
 			g_assert (scalar_arg == 1);
@@ -479,11 +485,23 @@ emit_sri_vector128 (TransformData *td, MonoMethod *cmethod, MonoMethodSignature
 			break;
 		case SN_WidenLower:
 			simd_opcode = MINT_SIMD_INTRINS_P_P;
-			if (atype == MONO_TYPE_U2) simd_intrins = INTERP_SIMD_INTRINSIC_V128_U2_WIDEN_LOWER;
+			if (atype == MONO_TYPE_I2) simd_intrins = INTERP_SIMD_INTRINSIC_V128_I2_WIDEN_LOWER;
+			else if (atype == MONO_TYPE_U2) simd_intrins = INTERP_SIMD_INTRINSIC_V128_U2_WIDEN_LOWER;
+			else if (atype == MONO_TYPE_I4) simd_intrins = INTERP_SIMD_INTRINSIC_V128_I4_WIDEN_LOWER;
+			else if (atype == MONO_TYPE_U4) simd_intrins = INTERP_SIMD_INTRINSIC_V128_U4_WIDEN_LOWER;
+			else if (atype == MONO_TYPE_I8) simd_intrins = INTERP_SIMD_INTRINSIC_V128_I8_WIDEN_LOWER;
+			else if (atype == MONO_TYPE_U8) simd_intrins = INTERP_SIMD_INTRINSIC_V128_U8_WIDEN_LOWER;
+			else if (atype == MONO_TYPE_R8) simd_intrins = INTERP_SIMD_INTRINSIC_V128_R8_WIDEN_LOWER;
 			break;
 		case SN_WidenUpper:
 			simd_opcode = MINT_SIMD_INTRINS_P_P;
-			if (atype == MONO_TYPE_U2) simd_intrins = INTERP_SIMD_INTRINSIC_V128_U2_WIDEN_UPPER;
+			if (atype == MONO_TYPE_I2) simd_intrins = INTERP_SIMD_INTRINSIC_V128_I2_WIDEN_UPPER;
+			else if (atype == MONO_TYPE_U2) simd_intrins = INTERP_SIMD_INTRINSIC_V128_U2_WIDEN_UPPER;
+			else if (atype == MONO_TYPE_I4) simd_intrins = INTERP_SIMD_INTRINSIC_V128_I4_WIDEN_UPPER;
+			else if (atype == MONO_TYPE_U4) simd_intrins = INTERP_SIMD_INTRINSIC_V128_U4_WIDEN_UPPER;
+			else if (atype == MONO_TYPE_I8) simd_intrins = INTERP_SIMD_INTRINSIC_V128_I8_WIDEN_UPPER;
+			else if (atype == MONO_TYPE_U8) simd_intrins = INTERP_SIMD_INTRINSIC_V128_U8_WIDEN_UPPER;
+			else if (atype == MONO_TYPE_R8) simd_intrins = INTERP_SIMD_INTRINSIC_V128_R8_WIDEN_UPPER;
 			break;
 		default:
 			return FALSE;
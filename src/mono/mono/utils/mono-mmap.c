@@ -510,6 +510,28 @@ mono_mprotect (void *addr, size_t length, int flags)
 
 #endif // HOST_WIN32
 
+/**
+ * mono_file_map_advise_prefetch:
+ * \param addr memory address returned by mono_file_map ()
+ * \param length size of the mapped area to prefetch
+ * Advise the OS to read the given range of a file mapping ahead of use, so
+ * later accesses don't fault it in page by page. Purely a hint: it's a no-op
+ * on platforms without madvise and failures are ignored.
+ */
+void
+mono_file_map_advise_prefetch (void *addr, size_t length)
+{
+#if !defined(HOST_WIN32) && defined(HAVE_MMAP)
+#ifdef __linux__
+	madvise (addr, length, MADV_WILLNEED);
+#elif defined(HAVE_MADVISE) && defined(MADV_WILLNEED)
+	madvise (addr, length, MADV_WILLNEED);
+#elif defined(POSIX_MADV_WILLNEED)
+	posix_madvise (addr, length, POSIX_MADV_WILLNEED);
+#endif
+#endif
+}
+
 #ifndef HAVE_VALLOC_ALIGNED
 void*
 mono_valloc_aligned (size_t size, size_t alignment, int flags, MonoMemAccountType type)
@@ -61,6 +61,7 @@ MONO_API void* mono_valloc     (void *addr, size_t length, int flags, MonoMemAcc
 MONO_API void* mono_valloc_aligned (size_t length, size_t alignment, int flags, MonoMemAccountType type);
 MONO_API int   mono_vfree      (void *addr, size_t length, MonoMemAccountType type);
 MONO_API void* mono_file_map   (size_t length, int flags, int fd, guint64 offset, void **ret_handle);
+MONO_API void  mono_file_map_advise_prefetch (void *addr, size_t length);
 
 // Last two parameters are optional.
 // This is mono_file_map but with optionally returning an error message.
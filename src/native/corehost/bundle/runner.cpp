@@ -19,6 +19,10 @@ StatusCode runner_t::extract()
     {
         const char* addr = map_bundle();
 
+        // The header and manifest live at the tail of the bundle; ask the OS to
+        // read that region ahead instead of faulting it in page by page.
+        pal::mmap_advise_prefetch(addr + m_header_offset, (size_t)(m_bundle_size - m_header_offset));
+
         // Set the Reader at header_offset
         reader_t reader(addr, m_bundle_size, m_header_offset);
         m_offset_in_file = reader.offset_in_file();
@@ -28,6 +32,13 @@ StatusCode runner_t::extract()
         m_deps_json.set_location(&m_header.deps_json_location());
         m_runtimeconfig_json.set_location(&m_header.runtimeconfig_json_location());
 
+        // hostpolicy parses both json files straight out of the bundle next;
+        // warm those ranges as well.
+        if (m_header.deps_json_location().is_valid())
+            pal::mmap_advise_prefetch(addr + m_header.deps_json_location().offset + m_offset_in_file, (size_t)m_header.deps_json_location().size);
+        if (m_header.runtimeconfig_json_location().is_valid())
+            pal::mmap_advise_prefetch(addr + m_header.runtimeconfig_json_location().offset + m_offset_in_file, (size_t)m_header.runtimeconfig_json_location().size);
+
         // Read the bundle manifest
         m_manifest = manifest_t::read(reader, m_header);
 
@@ -276,6 +276,10 @@ namespace pal
     const void* mmap_read(const string_t& path, size_t* length = nullptr);
     void* mmap_copy_on_write(const string_t& path, size_t* length = nullptr);
 
+    // Hint to the OS to read the given range of a mapped file ahead of use.
+    // Purely advisory; failures are ignored.
+    void mmap_advise_prefetch(const void* address, size_t length);
+
     bool touch_file(const string_t& path);
     bool realpath(string_t* path, bool skip_error_logging = false);
     bool file_exists(const string_t& path);
@@ -116,6 +116,25 @@ void* pal::mmap_copy_on_write(const string_t& path, size_t* length)
     return map_file(path, length, PROT_READ | PROT_WRITE, MAP_PRIVATE);
 }
 
+void pal::mmap_advise_prefetch(const void* address, size_t length)
+{
+#if defined(MADV_WILLNEED) || defined(POSIX_MADV_WILLNEED)
+    // madvise fails with EINVAL unless the address is page aligned. Callers
+    // pass interior pointers into a mapped bundle, so round down to the page
+    // boundary and cover the same end address.
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    size_t misalignment = (size_t)address & (page_size - 1);
+    void* aligned_address = (void*)((size_t)address - misalignment);
+    length += misalignment;
+
+#if defined(MADV_WILLNEED)
+    (void)madvise(aligned_address, length, MADV_WILLNEED);
+#else
+    (void)posix_madvise(aligned_address, length, POSIX_MADV_WILLNEED);
+#endif
+#endif
+}
+
 bool pal::getcwd(pal::string_t* recv)
 {
     recv->clear();
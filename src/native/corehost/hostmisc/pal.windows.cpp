@@ -121,6 +121,14 @@ void* pal::mmap_copy_on_write(const string_t& path, size_t* length)
     return map_file(path, length, PAGE_WRITECOPY, FILE_MAP_READ | FILE_MAP_COPY);
 }
 
+void pal::mmap_advise_prefetch(const void* address, size_t length)
+{
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = const_cast<void*>(address);
+    range.NumberOfBytes = length;
+    (void)::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0);
+}
+
 bool pal::getcwd(pal::string_t* recv)
 {
     recv->clear();
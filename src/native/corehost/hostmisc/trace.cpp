@@ -95,7 +95,10 @@ bool trace::enable()
 
             if (tracefile)
             {
-                setvbuf(tracefile, nullptr, _IONBF, 0);
+                // Fully buffer the trace file so tracing costs a memcpy per message
+                // instead of a write syscall. The buffer is flushed on error messages,
+                // by trace::flush() on the host exit paths, and by the CRT at exit.
+                setvbuf(tracefile, nullptr, _IOFBF, 64 * 1024);
                 g_trace_file = tracefile;
             }
             else
@@ -189,6 +192,11 @@ void trace::error(const pal::char_t* format, ...)
         if (g_trace_verbosity && ((g_trace_file != stderr) || g_error_writer != nullptr))
         {
             pal::file_vprintf(g_trace_file, format, trace_args);
+
+            // Make sure errors reach the trace file even if the process dies
+            // before an orderly flush.
+            if (g_trace_file != stderr)
+                std::fflush(g_trace_file);
         }
     }
     va_end(args);